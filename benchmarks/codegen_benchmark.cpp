@@ -0,0 +1,198 @@
+//-------------------------------------------------------------
+//! @file   codegen_benchmark.cpp
+//! @brief  TsukinoDIContainer o^̃R[hʃx`}[N
+//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @details ^ N i 1000jo^R[h𐶐ăRpCA
+//!          RpCԁEst@C̃TCYEo^Ɖ̎sԂ\B
+//!          rpɁA^𒼐ڍ\zAReiɂ 1 ^o^R[hibaselinejvB
+//!          baseline CuN邽߁A͌^Ƃ̓o^ẼR[ĥ݂ƂȂB
+//!          RpČĂяo GCC / Clang `̂ݑΉB
+//!          CMake ł -DTSUKINO_DI_BUILD_BENCHMARKS=ON ō\Arun_codegen_benchmark sB
+//!          g: codegen_benchmark [^̐] [ƃfBNg]
+//-------------------------------------------------------------
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// CMake niw莞 PATH  c++ ƃJgfBNg include gj
+#ifndef TSUKINO_DI_BENCH_CXX
+#define TSUKINO_DI_BENCH_CXX "c++"
+#endif
+#ifndef TSUKINO_DI_BENCH_INCLUDE
+#define TSUKINO_DI_BENCH_INCLUDE "include"
+#endif
+#ifndef TSUKINO_DI_BENCH_LIBRARY
+#define TSUKINO_DI_BENCH_LIBRARY ""
+#endif
+
+namespace {
+	namespace fs = std::filesystem;
+
+	//---------------------------------------------------------
+	//! @enum   Variant
+	//! @brief  o^R[h̎
+	//---------------------------------------------------------
+	enum class Variant {
+		Baseline,		//!< ^̒`ƒڍ\ziRei 1 ^̂ݓo^j
+		RegisterType,	//!< registerTypeiRXgN^ˑ𐄘_j
+		RegisterCtor	//!< registerCtoriˑ𖾎j
+	};
+
+	const char* toString(Variant variant) {
+		switch (variant) {
+		case Variant::Baseline:     return "baseline";
+		case Variant::RegisterType: return "registerType";
+		case Variant::RegisterCtor: return "registerCtor";
+		}
+		return "unknown";
+	}
+
+	//---------------------------------------------------------
+	//! @brief  ^ i ^ i - 1 Ɉˑ邩i4 ƂɈˑ̘A؂j
+	//---------------------------------------------------------
+	bool hasDependency(std::size_t i) {
+		return i % 4 != 0;
+	}
+
+	//---------------------------------------------------------
+	//! @brief  o^R[h𐶐
+	//---------------------------------------------------------
+	std::string generate(Variant variant, std::size_t count) {
+		std::ostringstream code;
+		code << "#include <chrono>\n#include <cstdio>\n#include <memory>\n#include <TsukinoDIContainer/TsukinoDIContainer.hpp>\n";
+		// ^̒`iC^[tF[XƎAȏ 1 Ǒ^Ɉˑj
+		for (std::size_t i = 0; i < count; ++i) {
+			code << "struct I" << i << " { virtual ~I" << i << "() = default; virtual int value() const = 0; };\n";
+			if (hasDependency(i)) {
+				code << "struct C" << i << " : I" << i << " { explicit C" << i << "(std::shared_ptr<I" << i - 1 << "> d) : d_(std::move(d)) {} "
+					<< "int value() const override { return d_->value() + 1; } std::shared_ptr<I" << i - 1 << "> d_; };\n";
+			}
+			else {
+				code << "struct C" << i << " : I" << i << " { int value() const override { return " << i << "; } };\n";
+			}
+		}
+		code << "int main() {\n\tconst auto begin = std::chrono::steady_clock::now();\n";
+		if (variant == Variant::Baseline) {
+			// ^𒼐ڍ\ziz֐\ȂǃReiȊÕ̕TCYj
+			// CǔŒ蕪𑵂邽߁AReiɂ 1 ^o^ĉ
+			code << "\tTsukinoDIContainer::Container container;\n"
+				<< "\tcontainer.registerType<I0, C0>(TsukinoDIContainer::Lifecycle::Singleton);\n"
+				<< "\tlong sum = container.validate().ok() ? container.resolve<I0>()->value() : -1;\n";
+			for (std::size_t i = 0; i < count; ++i) {
+				code << "\tstd::shared_ptr<I" << i << "> p" << i << " = std::make_shared<C" << i << ">(";
+				if (hasDependency(i)) code << "p" << i - 1;
+				code << "); sum += p" << i << "->value();\n";
+			}
+			code << "\tconst auto end = std::chrono::steady_clock::now();\n"
+				<< "\tstd::printf(\"  constructed in %lld us (sum %ld)\\n\", static_cast<long long>("
+				<< "std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()), sum);\n";
+		}
+		else {
+			code << "\tusing TsukinoDIContainer::Lifecycle;\n\tTsukinoDIContainer::Container container;\n";
+			for (std::size_t i = 0; i < count; ++i) {
+				if (variant == Variant::RegisterType) {
+					code << "\tcontainer.registerType<I" << i << ", C" << i << ">(Lifecycle::Singleton);\n";
+				}
+				else {
+					code << "\tcontainer.registerCtor<I" << i << ", C" << i;
+					if (hasDependency(i)) code << ", I" << i - 1;
+					code << ">(Lifecycle::Singleton);\n";
+				}
+			}
+			code << "\tconst auto registered = std::chrono::steady_clock::now();\n"
+				<< "\tconst bool valid = container.validate().ok();\n"
+				<< "\tconst auto validated = std::chrono::steady_clock::now();\n"
+				<< "\tlong sum = 0;\n";
+			for (std::size_t i = 0; i < count; ++i) {
+				code << "\tsum += container.resolve<I" << i << ">()->value();\n";
+			}
+			code << "\tconst auto resolved = std::chrono::steady_clock::now();\n"
+				<< "\tauto us = [](auto from, auto to) { return static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count()); };\n"
+				<< "\tstd::printf(\"  register %lld us, validate %lld us (%s), resolve %lld us (sum %ld)\\n\", "
+				<< "us(begin, registered), us(registered, validated), valid ? \"ok\" : \"NG\", us(validated, resolved), sum);\n";
+		}
+		code << "\treturn 0;\n}\n";
+		return code.str();
+	}
+
+	//---------------------------------------------------------
+	//! @brief  R}hsAoߎԁibjԂis͕j
+	//---------------------------------------------------------
+	double run(const std::string& command) {
+		const auto begin = std::chrono::steady_clock::now();
+		const int status = std::system(command.c_str());
+		const auto end = std::chrono::steady_clock::now();
+		if (status != 0) {
+			return -1.0;
+		}
+		return std::chrono::duration<double>(end - begin).count();
+	}
+
+	//---------------------------------------------------------
+	//! @brief  R}hCpɈpň͂
+	//---------------------------------------------------------
+	std::string quote(const std::string& text) {
+		return "\"" + text + "\"";
+	}
+}
+
+// Gg|Cg
+int main(int argc, char** argv) {
+	const std::size_t count = argc > 1 ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 1000;
+	const fs::path work = argc > 2 ? fs::path(argv[2]) : fs::temp_directory_path() / "tsukino_di_codegen";
+	const std::string library = TSUKINO_DI_BENCH_LIBRARY;
+	if (count == 0) {
+		std::cerr << "usage: codegen_benchmark [type count] [work directory]\n";
+		return 1;
+	}
+	fs::create_directories(work);
+
+	std::cout << "Generated registration set: " << count << " types (compiler: " << TSUKINO_DI_BENCH_CXX << ")\n";
+	std::printf("%-14s %12s %14s %16s\n", "variant", "compile(s)", "binary(KiB)", "bytes/type(+)");
+	std::uintmax_t baselineSize = 0;
+	std::vector<std::string> programs;
+	for (Variant variant : { Variant::Baseline, Variant::RegisterType, Variant::RegisterCtor }) {
+		const fs::path source = work / (std::string(toString(variant)) + ".cpp");
+		const fs::path binary = work / toString(variant);
+		std::ofstream(source) << generate(variant, count);
+
+		// 1 ̖|PʂƂāAۂ̗pƓœKŃRpCăN
+		std::string command = std::string(TSUKINO_DI_BENCH_CXX) + " -std=c++17 -O2 -I" + quote(TSUKINO_DI_BENCH_INCLUDE)
+			+ " " + quote(source.string()) + " -o " + quote(binary.string());
+		if (!library.empty()) {
+			command += " " + quote(library);
+		}
+		command += " -pthread";
+		const double seconds = run(command);
+		if (seconds < 0) {
+			std::cerr << "compile failed: " << command << "\n";
+			return 1;
+		}
+		const std::uintmax_t size = fs::file_size(binary);
+		if (variant == Variant::Baseline) {
+			baselineSize = size;
+		}
+		// baseline Ƃ̍^̐Ŋlio^ 1 ɑR[hʁj
+		const double perType = variant == Variant::Baseline ? 0.0 : (static_cast<double>(size) - static_cast<double>(baselineSize)) / count;
+		std::printf("%-14s %12.2f %14.1f %16.1f\n", toString(variant), seconds, size / 1024.0, perType);
+		programs.push_back(binary.string());
+	}
+
+	// vO̎sԁio^E؁Ej
+	std::cout << "Runtime:\n";
+	for (const auto& program : programs) {
+		std::cout << fs::path(program).filename().string() << "\n" << std::flush;
+		if (run(quote(program)) < 0) {
+			std::cerr << "run failed: " << program << "\n";
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------
+//! @file   example10_graph.cpp
+//! @brief  TsukinoDIContainer 依存グラフ出力 / クリティカルパス解析の使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   Config / Database / Cache / Repository / Service
+//! @brief   起動時に構築される型（構築コストを sleep で模擬）
+//-------------------------------------------------------------
+struct Config {
+	Config() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+};
+struct Database {
+	explicit Database(std::shared_ptr<Config>) { std::this_thread::sleep_for(std::chrono::milliseconds(30)); }
+};
+struct Cache {
+	explicit Cache(std::shared_ptr<Config>) { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }
+};
+struct Repository {
+	Repository(std::shared_ptr<Database>, std::shared_ptr<Cache>) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); }
+};
+struct Service {
+	explicit Service(std::shared_ptr<Repository>) {}
+};
+struct Metrics {
+	Metrics() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+
+	// コンテナ生成と構築時間計測の有効化
+	TsukinoDIContainer::Container container;
+	container.enableConstructionTiming(true);
+
+	// 依存付きで登録
+	container.registerCtor<Config, Config>(Lifecycle::Singleton);
+	container.registerCtor<Database, Database, Config>(Lifecycle::Singleton);
+	container.registerCtor<Cache, Cache, Config>(Lifecycle::Singleton);
+	container.registerCtor<Repository, Repository, Database, Cache>(Lifecycle::Singleton);
+	container.registerCtor<Service, Service, Repository>(Lifecycle::Transient);
+	container.registerCtor<Metrics, Metrics>(Lifecycle::Singleton);
+
+	// ウォームアップ（起動時の解決を実行して構築時間を集計）
+	container.resolve<Service>();
+	container.resolve<Metrics>();
+
+	// グラフを取得
+	const auto graph = container.exportGraph();
+
+	// クリティカルパス（起動時間を支配する依存の連鎖）
+	std::cout << "Critical path:";
+	for (auto index : graph.criticalPath()) {
+		std::cout << " " << graph.nodes()[index].name_;
+	}
+	std::cout << std::endl;
+	std::cout << "Critical path time: " << graph.criticalPathNanos() / 1000000 << "ms" << std::endl;
+	std::cout << "Parallel width: " << graph.parallelWidth() << std::endl;
+
+	// Graphviz / JSON 形式で出力（dot -Tsvg などで可視化）
+	std::cout << graph.toDot() << std::endl;
+	std::cout << graph.toJson() << std::endl;
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,94 @@
+//-------------------------------------------------------------
+//! @file   example11_validate.cpp
+//! @brief  TsukinoDIContainer 起動時の依存グラフ検証の使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   ILogger / IRepository / IRequestContext
+//! @brief   検証用インターフェース
+//-------------------------------------------------------------
+struct ILogger { virtual ~ILogger() = default; };
+struct IRepository { virtual ~IRepository() = default; };
+struct IRequestContext { virtual ~IRequestContext() = default; };
+struct IMailer { virtual ~IMailer() = default; };
+
+//-------------------------------------------------------------
+//! @class   ConsoleLogger / RequestContext
+//! @brief   依存なしの実装
+//-------------------------------------------------------------
+struct ConsoleLogger : public ILogger {};
+struct RequestContext : public IRequestContext {};
+
+//-------------------------------------------------------------
+//! @class   Repository
+//! @brief   ロガーとリクエスト文脈に依存する実装
+//-------------------------------------------------------------
+struct Repository : public IRepository {
+	Repository(std::shared_ptr<ILogger>, std::shared_ptr<IRequestContext>) {}
+};
+
+//-------------------------------------------------------------
+//! @class   Service
+//! @brief   リポジトリとメール送信に依存するサービス
+//-------------------------------------------------------------
+struct Service {
+	Service(std::shared_ptr<IRepository>, std::shared_ptr<IMailer>) {}
+};
+
+//-------------------------------------------------------------
+//! @class   Scheduler
+//! @brief   時計を参照で保持する実装（参照先は Singleton に限る）
+//-------------------------------------------------------------
+struct IClock { virtual ~IClock() = default; };
+struct SystemClock : public IClock {};
+struct Scheduler {
+	explicit Scheduler(const IClock& clock) : clock_(clock) {}
+	const IClock& clock_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+
+	// コンテナ生成
+	TsukinoDIContainer::Container container;
+
+	// 1) 問題のある登録（IMailer は未登録、Singleton の Repository が Scoped を保持、Scheduler が Transient を参照で保持）
+	container.registerCtor<ILogger, ConsoleLogger>(Lifecycle::Singleton);
+	container.registerCtor<IRequestContext, RequestContext>(Lifecycle::Scoped);
+	container.registerCtor<IRepository, Repository, ILogger, IRequestContext>(Lifecycle::Singleton);
+	container.registerCtor<Service, Service, IRepository, IMailer>(Lifecycle::Transient);
+	container.registerType<IClock, SystemClock>(Lifecycle::Transient);
+	container.registerType<Scheduler, Scheduler>(Lifecycle::Transient);
+
+	// 2) 起動時に全体を検証（最初の解決を待たずに全ての問題をまとめて取得）
+	auto report = container.validate();
+	std::cout << "Validation " << (report.ok() ? "passed" : "failed") << ":" << std::endl;
+	std::cout << report.toString();
+
+	// 3) 登録を修正して再検証
+	container.replaceCtor<IRepository, Repository, ILogger, IRequestContext>(Lifecycle::Scoped);
+	container.replaceInstance<IMailer>(std::make_shared<IMailer>());
+	container.replaceType<IClock, SystemClock>(Lifecycle::Singleton);
+	report = container.validate();
+	std::cout << "Validation " << (report.ok() ? "passed" : "failed") << std::endl;
+
+	// 4) 検証後の解決は循環依存検出を省略する
+	auto service = container.resolve<Service>();
+	std::cout << "Service resolved" << std::endl;
+
+	// 5) throwIfFailed で起動を中断することもできる
+	try {
+		TsukinoDIContainer::Container broken;
+		broken.registerCtor<Service, Service, IRepository, IMailer>(Lifecycle::Transient);
+		broken.validate().throwIfFailed();
+	}
+	catch (const TsukinoDIContainer::ResolveException& ex) {
+		std::cerr << "[Error] " << ex.what();
+	}
+	// プログラムの終了
+	return 0;
+}
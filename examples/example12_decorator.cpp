@@ -0,0 +1,129 @@
+//-------------------------------------------------------------
+//! @file   example12_decorator.cpp
+//! @brief  TsukinoDIContainer デコレータ登録の使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IWeather
+//! @brief   天気取得サービスのインターフェース
+//-------------------------------------------------------------
+struct IWeather {
+	virtual std::string forecast(const std::string& city) = 0;
+	virtual ~IWeather() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   IMetrics
+//! @brief   計測値の出力先インターフェース
+//-------------------------------------------------------------
+struct IMetrics {
+	virtual void count(const std::string& name) = 0;
+	virtual ~IMetrics() = default;
+};
+struct ConsoleMetrics : public IMetrics {
+	void count(const std::string& name) override { std::cout << "  [metrics] " << name << std::endl; }
+};
+
+//-------------------------------------------------------------
+//! @class   RemoteWeather
+//! @brief   外部 API を呼び出す想定の実装
+//-------------------------------------------------------------
+struct RemoteWeather : public IWeather {
+	std::string forecast(const std::string& city) override {
+		std::cout << "  [remote] fetch " << city << std::endl;
+		return city + ": sunny";
+	}
+};
+
+//-------------------------------------------------------------
+//! @class   CachingWeather
+//! @brief   キャッシュデコレータ（実行時合成：内側をインターフェースで保持）
+//-------------------------------------------------------------
+struct CachingWeather : public IWeather {
+	explicit CachingWeather(std::shared_ptr<IWeather> inner) : inner_(std::move(inner)) {}
+	std::string forecast(const std::string& city) override {
+		auto it = cache_.find(city);
+		if (it != cache_.end()) return it->second;
+		return cache_[city] = inner_->forecast(city);
+	}
+private:
+	std::shared_ptr<IWeather> inner_;						// 内側のサービス
+	std::unordered_map<std::string, std::string> cache_;	// 取得済みの結果
+};
+
+//-------------------------------------------------------------
+//! @class   MetricsWeather
+//! @brief   計測デコレータ（実行時合成：自身の依存 IMetrics を持つ）
+//-------------------------------------------------------------
+struct MetricsWeather : public IWeather {
+	MetricsWeather(std::shared_ptr<IWeather> inner, std::shared_ptr<IMetrics> metrics)
+		: inner_(std::move(inner)), metrics_(std::move(metrics)) {}
+	std::string forecast(const std::string& city) override {
+		metrics_->count("forecast");
+		return inner_->forecast(city);
+	}
+private:
+	std::shared_ptr<IWeather> inner_;		// 内側のサービス
+	std::shared_ptr<IMetrics> metrics_;		// 計測値の出力先
+};
+
+//-------------------------------------------------------------
+//! @class   Retry / Logging
+//! @brief   静的デコレータ（内側を具象型の値で保持し、引数を内側へ転送）
+//-------------------------------------------------------------
+template<typename TInner>
+struct Retry : public IWeather {
+	template<typename... TArgs>
+	explicit Retry(TArgs&&... args) : inner_(std::forward<TArgs>(args)...) {}
+	std::string forecast(const std::string& city) override {
+		for (int attempt = 0;; ++attempt) {
+			try { return inner_.TInner::forecast(city); }	// 具象型を直接呼ぶため仮想呼び出しにならない
+			catch (...) { if (attempt == 2) throw; }
+		}
+	}
+private:
+	TInner inner_;	// 内側の実装
+};
+template<typename TInner>
+struct Logging : public IWeather {
+	template<typename... TArgs>
+	explicit Logging(TArgs&&... args) : inner_(std::forward<TArgs>(args)...) {}
+	std::string forecast(const std::string& city) override {
+		std::cout << "  [log] forecast(" << city << ")" << std::endl;
+		return inner_.TInner::forecast(city);
+	}
+private:
+	TInner inner_;	// 内側の実装
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+
+	// 1) 実行時合成：登録済みの型にデコレータを重ねる（後から登録したものが外側）
+	TsukinoDIContainer::Container container;
+	container.registerType<IMetrics, ConsoleMetrics>(Lifecycle::Singleton);
+	container.registerType<IWeather, RemoteWeather>(Lifecycle::Singleton);
+	container.registerDecorator<IWeather, CachingWeather>();
+	container.registerDecorator<IWeather, MetricsWeather, IMetrics>();
+
+	auto weather = container.resolve<IWeather>();	// MetricsWeather(CachingWeather(RemoteWeather))
+	std::cout << "Dynamic chain:" << std::endl;
+	std::cout << weather->forecast("Tokyo") << std::endl;
+	std::cout << weather->forecast("Tokyo") << std::endl;	// 2 回目はキャッシュから
+
+	// 2) 静的合成：Logging<Retry<RemoteWeather>> を 1 つのオブジェクトとして構築
+	TsukinoDIContainer::Container fast;
+	fast.registerDecorated<IWeather, RemoteWeather,
+		TsukinoDIContainer::Decorators<Retry, Logging>>(Lifecycle::Singleton);
+	std::cout << "Static chain:" << std::endl;
+	std::cout << fast.resolve<IWeather>()->forecast("Osaka") << std::endl;
+	// プログラムの終了
+	return 0;
+}
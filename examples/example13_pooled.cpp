@@ -0,0 +1,65 @@
+//-------------------------------------------------------------
+//! @file   example13_pooled.cpp
+//! @brief  TsukinoDIContainer Pooled ライフサイクル使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IParser
+//! @brief   パーサーインターフェース
+//-------------------------------------------------------------
+struct IParser {
+	virtual std::size_t parse(const std::string& text) = 0;
+	virtual ~IParser() = default;
+};
+
+static int g_constructed = 0;	// 構築回数
+
+//-------------------------------------------------------------
+//! @class   JsonParser
+//! @brief   構築は重いがリセットは軽いパーサー
+//-------------------------------------------------------------
+struct JsonParser : public IParser {
+	JsonParser() {
+		++g_constructed;
+		buffer_.reserve(64 * 1024);	// 大きな作業領域を確保
+	}
+	std::size_t parse(const std::string& text) override {
+		buffer_.insert(buffer_.end(), text.begin(), text.end());
+		return buffer_.size();
+	}
+	// プールへ戻る時に呼ばれる（作業領域は解放せずに再利用）
+	void reset() { buffer_.clear(); }
+private:
+	std::vector<char> buffer_;	// 作業領域
+};
+
+// エントリポイント
+int main() {
+	// コンテナ生成と Pooled 登録
+	TsukinoDIContainer::Container container;
+	container.registerType<IParser, JsonParser>(TsukinoDIContainer::Lifecycle::Pooled);
+	container.setPoolCapacity<IParser>(16);	// 空きは最大 16 個まで保持
+
+	// 1) 解放したハンドルはリセットされてプールへ戻り、次の解決で再利用される
+	for (int i = 0; i < 1000; ++i) {
+		auto parser = container.resolve<IParser>();
+		if (parser->parse("{\"id\": 1}") != 9) {
+			std::cout << "Parser was not reset" << std::endl;
+		}
+	}
+	std::cout << "1000 resolves, constructed " << g_constructed << " time(s)" << std::endl;
+
+	// 2) 同時に使用中の分だけ新しく構築される
+	{
+		auto a = container.resolve<IParser>();
+		auto b = container.resolve<IParser>();
+		std::cout << "Two in use: " << (a != b ? "distinct" : "same") << ", constructed " << g_constructed << " time(s)" << std::endl;
+	}
+	// プログラムの終了
+	return 0;
+}
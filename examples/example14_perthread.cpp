@@ -0,0 +1,84 @@
+//-------------------------------------------------------------
+//! @file   example14_perthread.cpp
+//! @brief  TsukinoDIContainer PerThread ライフサイクル使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <atomic>
+#include <future>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <set>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IRandom
+//! @brief   乱数生成インターフェース（スレッドセーフではない）
+//-------------------------------------------------------------
+struct IRandom {
+	virtual unsigned next() = 0;
+	virtual ~IRandom() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   MtRandom
+//! @brief   std::mt19937 による実装（ロックなしで使うためスレッドごとに持つ）
+//-------------------------------------------------------------
+struct MtRandom : public IRandom {
+	MtRandom() { ++alive_; }
+	~MtRandom() override { --alive_; }
+	unsigned next() override { return static_cast<unsigned>(engine_()); }
+	static inline std::atomic<int> alive_{ 0 };	// 生存中のインスタンス数
+private:
+	std::mt19937 engine_{ std::random_device{}() };	// 乱数エンジン
+};
+
+// エントリポイント
+int main() {
+	// コンテナ生成と PerThread 登録
+	TsukinoDIContainer::Container container;
+	container.registerType<IRandom, MtRandom>(TsukinoDIContainer::Lifecycle::PerThread);
+	container.enableResolveCache(true);	// 2 回目以降の解決はスレッドローカルキャッシュのみで完了
+
+	// 各スレッドで解決し、同じスレッド内では同じインスタンス、スレッド間では別のインスタンスになることを確認
+	std::mutex mutex;
+	std::set<std::shared_ptr<IRandom>> instances;	// 比較のため保持（アドレスの再利用を防ぐ）
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i) {
+		threads.emplace_back([&container, &mutex, &instances]() {
+			auto first = container.resolve<IRandom>();
+			for (int n = 0; n < 100000; ++n) {
+				if (container.resolve<IRandom>() != first) {
+					std::cout << "Different instance in the same thread" << std::endl;
+				}
+				first->next();	// ロックなしで使用
+			}
+			std::lock_guard<std::mutex> lock(mutex);
+			instances.insert(first);
+		});	// スレッド終了時にそのスレッドのインスタンスは破棄される
+	}
+	for (auto& t : threads) {
+		t.join();
+	}
+	std::cout << "4 threads used " << instances.size() << " instance(s)" << std::endl;
+	instances.clear();
+
+	// 登録を置き換えると、生存中のスレッドに残った旧インスタンスはそのスレッドの次の解決時に破棄される
+	std::promise<void> resolved;
+	std::promise<void> replaced;
+	std::thread worker([&container, &resolved, done = replaced.get_future()]() {
+		container.resolve<IRandom>();
+		resolved.set_value();
+		done.wait();
+		container.resolve<IRandom>();
+		std::cout << "Alive after replace and re-resolve: " << MtRandom::alive_ << std::endl;
+	});
+	resolved.get_future().wait();
+	container.replaceType<IRandom, MtRandom>(TsukinoDIContainer::Lifecycle::Singleton);	// スレッド間で共有する実装へ切り替え
+	replaced.set_value();
+	worker.join();
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,101 @@
+//-------------------------------------------------------------
+//! @file   example15_batch.cpp
+//! @brief  TsukinoDIContainer 一括登録使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   ILogger
+//! @brief   ロガーインターフェース
+//-------------------------------------------------------------
+struct ILogger {
+	virtual void log(const std::string& msg) = 0;
+	virtual ~ILogger() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   ConsoleLogger
+//! @brief   コンソール出力ロガー
+//-------------------------------------------------------------
+struct ConsoleLogger : public ILogger {
+	void log(const std::string& msg) override { std::cout << "[Log] " << msg << std::endl; }
+};
+
+//-------------------------------------------------------------
+//! @class   IRepository
+//! @brief   リポジトリインターフェース
+//-------------------------------------------------------------
+struct IRepository {
+	virtual std::string find(int id) = 0;
+	virtual ~IRepository() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   MemoryRepository
+//! @brief   メモリ上のリポジトリ
+//-------------------------------------------------------------
+struct MemoryRepository : public IRepository {
+	explicit MemoryRepository(std::shared_ptr<ILogger> logger) : logger_(std::move(logger)) {}
+	std::string find(int id) override {
+		logger_->log("find " + std::to_string(id));
+		return "user" + std::to_string(id);
+	}
+private:
+	std::shared_ptr<ILogger> logger_;	// ロガー
+};
+
+//-------------------------------------------------------------
+//! @class   IConfig
+//! @brief   設定インターフェース
+//-------------------------------------------------------------
+struct IConfig {
+	virtual std::string name() const = 0;
+	virtual ~IConfig() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   AppConfig
+//! @brief   アプリケーション設定
+//-------------------------------------------------------------
+struct AppConfig : public IConfig {
+	std::string name() const override { return "batch-example"; }
+};
+
+// 登録表はコンパイル時に構築される（静的初期化の順序にも依存しない）
+static constexpr TsukinoDIContainer::StaticRegistration kRegistrations[] = {
+	TsukinoDIContainer::bindType<ILogger, ConsoleLogger>(TsukinoDIContainer::Lifecycle::Singleton),
+	TsukinoDIContainer::bindCtor<IRepository, MemoryRepository, ILogger>(TsukinoDIContainer::Lifecycle::Transient),
+};
+
+// エントリポイント
+int main() {
+	TsukinoDIContainer::Container container;
+
+	// 1) 登録表とインスタンスをまとめて登録（ロックはシャードごとに 1 回）
+	TsukinoDIContainer::RegistrationBatch batch;
+	batch.reserve(3)
+		.add(kRegistrations)
+		.registerInstance<IConfig>(std::make_shared<AppConfig>());
+	container.registerBatch(std::move(batch));
+
+	std::cout << container.resolve<IConfig>()->name() << ": " << container.resolve<IRepository>()->find(42) << std::endl;
+
+	// 2) 重複があれば 1 件も登録されず、重複した型が全て報告される
+	TsukinoDIContainer::RegistrationBatch conflicting;
+	conflicting
+		.registerType<IConfig, AppConfig>()
+		.registerCtor<IRepository, MemoryRepository, ILogger>()
+		.registerType<ILogger, ConsoleLogger>();
+	try {
+		container.registerBatch(std::move(conflicting));
+	}
+	catch (const TsukinoDIContainer::ResolveException& e) {
+		std::cout << "Rejected " << e.types().size() << " duplicate(s): " << e.what() << std::endl;
+	}
+	std::cout << "Still resolves: " << container.resolve<IRepository>()->find(7) << std::endl;
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------
+//! @file   example16_module.cpp
+//! @brief  TsukinoDIContainer モジュールの遅延読み込み使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   ILogger
+//! @brief   ロガーインターフェース
+//-------------------------------------------------------------
+struct ILogger {
+	virtual void log(const std::string& msg) = 0;
+	virtual ~ILogger() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   ConsoleLogger
+//! @brief   コンソール出力ロガー
+//-------------------------------------------------------------
+struct ConsoleLogger : public ILogger {
+	void log(const std::string& msg) override { std::cout << "[Log] " << msg << std::endl; }
+};
+
+//-------------------------------------------------------------
+//! @class   IHttpServer
+//! @brief   HTTP サーバーインターフェース（サーバープロセスのみ使用）
+//-------------------------------------------------------------
+struct IHttpServer {
+	virtual void listen(int port) = 0;
+	virtual ~IHttpServer() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   HttpServer
+//! @brief   HTTP サーバー
+//-------------------------------------------------------------
+struct HttpServer : public IHttpServer {
+	explicit HttpServer(std::shared_ptr<ILogger> logger) : logger_(std::move(logger)) {}
+	void listen(int port) override { logger_->log("listening on " + std::to_string(port)); }
+private:
+	std::shared_ptr<ILogger> logger_;	// ロガー
+};
+
+//-------------------------------------------------------------
+//! @struct  LoggingModule
+//! @brief   ログ関連の登録をまとめたモジュール
+//-------------------------------------------------------------
+struct LoggingModule {
+	using Exports = TsukinoDIContainer::ModuleExports<ILogger>;
+	static void configure(TsukinoDIContainer::Container& container) {
+		std::cout << "LoggingModule loaded" << std::endl;
+		container.registerType<ILogger, ConsoleLogger>(TsukinoDIContainer::Lifecycle::Singleton);
+	}
+};
+
+//-------------------------------------------------------------
+//! @struct  ServerModule
+//! @brief   サーバー関連の登録をまとめたモジュール
+//-------------------------------------------------------------
+struct ServerModule {
+	using Exports = TsukinoDIContainer::ModuleExports<IHttpServer>;
+	static void configure(TsukinoDIContainer::Container& container) {
+		std::cout << "ServerModule loaded" << std::endl;
+		container.registerCtor<IHttpServer, HttpServer, ILogger>(TsukinoDIContainer::Lifecycle::Singleton);
+	}
+};
+
+// エントリポイント
+int main() {
+	// モジュールを追加（この時点ではどちらの configure も呼ばれない）
+	TsukinoDIContainer::Container container;
+	container.addModule<LoggingModule>();
+	container.addModule<ServerModule>();
+	std::cout << "Modules added" << std::endl;
+
+	// 公開する型を読み込み前に個別登録すると、読み込み時の登録と重複するため拒否される
+	try {
+		container.registerType<ILogger, ConsoleLogger>();
+	}
+	catch (const TsukinoDIContainer::ResolveException& e) {
+		std::cout << e.what() << std::endl;
+	}
+
+	// 1) ILogger だけを使うツールでは LoggingModule だけが読み込まれる
+	container.resolve<ILogger>()->log("tool started");
+
+	// 2) IHttpServer を初めて解決した時点で ServerModule が読み込まれる
+	container.resolve<IHttpServer>()->listen(8080);
+	container.resolve<IHttpServer>()->listen(8081);	// 2 回目以降は読み込み済み
+	// プログラムの終了
+	return 0;
+}
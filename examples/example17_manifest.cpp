@@ -0,0 +1,111 @@
+//-------------------------------------------------------------
+//! @file   example17_manifest.cpp
+//! @brief  TsukinoDIContainer 登録マニフェスト使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IConfig
+//! @brief   設定インターフェース
+//-------------------------------------------------------------
+struct IConfig {
+	virtual ~IConfig() = default;
+};
+struct AppConfig : public IConfig {};
+
+//-------------------------------------------------------------
+//! @class   IDatabase
+//! @brief   データベースインターフェース
+//-------------------------------------------------------------
+struct IDatabase {
+	virtual ~IDatabase() = default;
+};
+struct SqlDatabase : public IDatabase {
+	explicit SqlDatabase(std::shared_ptr<IConfig>) {}
+};
+
+//-------------------------------------------------------------
+//! @class   ICache
+//! @brief   キャッシュインターフェース
+//-------------------------------------------------------------
+struct ICache {
+	virtual ~ICache() = default;
+};
+struct MemoryCache : public ICache {
+	explicit MemoryCache(std::shared_ptr<IConfig>) {}
+};
+
+//-------------------------------------------------------------
+//! @class   IService
+//! @brief   サービスインターフェース
+//-------------------------------------------------------------
+struct IService {
+	virtual ~IService() = default;
+};
+struct UserService : public IService {
+	UserService(std::shared_ptr<IDatabase>, std::shared_ptr<ICache>) {}
+};
+struct LegacyUserService : public IService {
+	explicit LegacyUserService(std::shared_ptr<IDatabase>) {}
+};
+
+// アプリケーションの登録処理
+static void configure(TsukinoDIContainer::Container& container) {
+	using TsukinoDIContainer::Lifecycle;
+	container.registerType<IConfig, AppConfig>(Lifecycle::Singleton);
+	container.registerCtor<IDatabase, SqlDatabase, IConfig>(Lifecycle::Singleton);
+	container.registerCtor<ICache, MemoryCache, IConfig>(Lifecycle::Singleton);
+	container.registerCtor<IService, UserService, IDatabase, ICache>(Lifecycle::Transient);
+}
+
+// エントリポイント
+int main() {
+	// 1) 前回の起動: 検証してからマニフェストを保存
+	std::string saved;
+	{
+		TsukinoDIContainer::Container container;
+		configure(container);
+		container.validate().throwIfFailed();
+		const auto manifest = container.exportManifest();
+		saved = manifest.toBinary();	// 実際にはファイルへ保存する
+		std::cout << "Saved " << saved.size() << " bytes, order:";
+		for (auto id : manifest.order()) {
+			std::cout << " " << manifest.entries()[id].name_;
+		}
+		std::cout << std::endl;
+	}
+
+	// 2) 次回の起動: 同じビルドなら validate を省略して検証済みにできる
+	{
+		TsukinoDIContainer::Container container;
+		configure(container);
+		const auto manifest = TsukinoDIContainer::ContainerManifest::fromBinary(saved);
+		std::cout << "Manifest applied: " << (container.loadManifest(manifest) ? "yes" : "no (validate instead)") << std::endl;
+	}
+
+	// 3) 別ビルドのマニフェストは本体を読む前に拒否される
+	try {
+		TsukinoDIContainer::ContainerManifest::fromBinary(saved, TsukinoDIContainer::ContainerManifest::currentBuildHash() + 1);
+	}
+	catch (const TsukinoDIContainer::ResolveException& e) {
+		std::cout << e.what() << std::endl;
+	}
+
+	// 4) ビルド間の差分（登録内容が変わればマニフェストも適用されない）
+	{
+		TsukinoDIContainer::Container container;
+		container.registerType<IConfig, AppConfig>(TsukinoDIContainer::Lifecycle::Singleton);
+		container.registerCtor<IDatabase, SqlDatabase, IConfig>(TsukinoDIContainer::Lifecycle::Transient);
+		container.registerCtor<IService, LegacyUserService, IDatabase>(TsukinoDIContainer::Lifecycle::Transient);
+		const auto before = TsukinoDIContainer::ContainerManifest::fromBinary(saved);
+		for (const auto& change : before.diff(container.exportManifest())) {
+			std::cout << change << std::endl;
+		}
+		std::cout << "Manifest applied: " << (container.loadManifest(before) ? "yes" : "no (validate instead)") << std::endl;
+	}
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,134 @@
+//-------------------------------------------------------------
+//! @file   example18_autowire.cpp
+//! @brief  TsukinoDIContainer コンストラクタ引数の自動推論使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IConfig
+//! @brief   設定インターフェース
+//-------------------------------------------------------------
+struct IConfig {
+	virtual ~IConfig() = default;
+	virtual std::string name() const = 0;
+};
+struct AppConfig : public IConfig {
+	std::string name() const override { return "app"; }
+};
+
+//-------------------------------------------------------------
+//! @class   ILogger
+//! @brief   ロガーインターフェース
+//-------------------------------------------------------------
+struct ILogger {
+	virtual ~ILogger() = default;
+	virtual void log(const std::string& message) = 0;
+};
+// 設定は参照で受け取る（Singleton なので参照を保持しても安全）
+struct ConsoleLogger : public ILogger {
+	explicit ConsoleLogger(const IConfig& config) : prefix_(config.name()) {}
+	void log(const std::string& message) override { std::cout << "[" << prefix_ << "] " << message << std::endl; }
+	std::string prefix_;
+};
+
+//-------------------------------------------------------------
+//! @class   IReport
+//! @brief   レポートインターフェース（重い初期化を想定）
+//-------------------------------------------------------------
+struct IReport {
+	virtual ~IReport() = default;
+	virtual std::string build() = 0;
+};
+struct MonthlyReport : public IReport {
+	MonthlyReport() { std::cout << "MonthlyReport constructed" << std::endl; }
+	std::string build() override { return "monthly report"; }
+};
+
+//-------------------------------------------------------------
+//! @class   IService
+//! @brief   サービスインターフェース
+//-------------------------------------------------------------
+struct IService {
+	virtual ~IService() = default;
+	virtual void run(bool withReport) = 0;
+};
+// ロガーは即時に、レポートは必要になった時点で解決する
+struct UserService : public IService {
+	UserService(std::shared_ptr<ILogger> logger, TsukinoDIContainer::Lazy<IReport> report)
+		: logger_(std::move(logger)), report_(std::move(report)) {
+	}
+	void run(bool withReport) override {
+		logger_->log("run");
+		if (withReport) {
+			logger_->log(report_->build());
+		}
+	}
+	std::shared_ptr<ILogger> logger_;
+	TsukinoDIContainer::Lazy<IReport> report_;
+};
+
+//-------------------------------------------------------------
+//! @class   IAudit
+//! @brief   多重継承の 2 番目の基底として登録するインターフェース
+//-------------------------------------------------------------
+struct IAudit {
+	virtual ~IAudit() = default;
+	virtual int count() const = 0;
+};
+struct AuditLogger : public ILogger, public IAudit {
+	void log(const std::string&) override { ++count_; }
+	int count() const override { return count_; }
+	int count_ = 0;
+};
+
+//-------------------------------------------------------------
+//! @class   IExporter
+//! @brief   同じ数の引数のコンストラクタを複数持つ型のインターフェース
+//-------------------------------------------------------------
+struct IExporter {
+	virtual ~IExporter() = default;
+	virtual std::string target() const = 0;
+};
+// 引数 2 個のコンストラクタは曖昧なため推論の対象外となり、一意な引数 1 個のコンストラクタが使われる
+// （引数 1 個のコンストラクタもなければ static_assert で停止するため registerCtor で明示する）
+struct FileExporter : public IExporter {
+	FileExporter(std::shared_ptr<ILogger> logger, std::shared_ptr<IReport> report) : target_("report") { (void)logger; (void)report; }
+	FileExporter(std::shared_ptr<IReport> report, std::shared_ptr<ILogger> logger) : target_("report") { (void)report; (void)logger; }
+	explicit FileExporter(std::shared_ptr<ILogger> logger) : target_("log") { (void)logger; }
+	std::string target() const override { return target_; }
+	std::string target_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+
+	// registerCtor のように依存型を列挙しなくても、コンストラクタから推論される
+	container.registerType<IConfig, AppConfig>(Lifecycle::Singleton);
+	container.registerType<ILogger, ConsoleLogger>(Lifecycle::Singleton);
+	container.registerType<IReport, MonthlyReport>(Lifecycle::Singleton);
+	container.registerType<IService, UserService>(Lifecycle::Transient);
+	container.registerType<IAudit, AuditLogger>(Lifecycle::Singleton);
+	container.registerType<IExporter, FileExporter>(Lifecycle::Transient);
+
+	// 推論された依存は validate / 依存グラフにも反映される（Lazy<T> は辺にならない）
+	std::cout << "Valid: " << (container.validate().ok() ? "yes" : "no") << std::endl;
+
+	auto service = container.resolve<IService>();
+	service->run(false);	// レポートはまだ構築されない
+	service->run(true);		// 初回参照で構築
+
+	// 2 番目の基底クラスでも正しい位置を指す
+	auto audit = container.resolve<IAudit>();
+	std::cout << "Audit count: " << audit->count() << std::endl;
+
+	// 曖昧な引数 2 個のコンストラクタではなく、引数 1 個のコンストラクタで構築される
+	std::cout << "Exporter target: " << container.resolve<IExporter>()->target() << std::endl;
+
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,60 @@
+//-------------------------------------------------------------
+//! @file   example19_lockprofile.cpp
+//! @brief  TsukinoDIContainer ロック計測使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//! @details TSUKINO_DI_LOCK_PROFILING=1 でライブラリごとビルドした場合に計測結果が表示される
+//!          （CMake では -DTSUKINO_DI_LOCK_PROFILING=ON）
+//-------------------------------------------------------------
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IConfig
+//! @brief   設定インターフェース
+//-------------------------------------------------------------
+struct IConfig {
+	virtual ~IConfig() = default;
+};
+struct AppConfig : public IConfig {
+	AppConfig() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }	// 重い初期化を想定
+};
+
+//-------------------------------------------------------------
+//! @class   IRequest
+//! @brief   リクエストインターフェース
+//-------------------------------------------------------------
+struct IRequest {
+	virtual ~IRequest() = default;
+};
+struct Request : public IRequest {
+	explicit Request(std::shared_ptr<IConfig>) {}
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<IConfig, AppConfig>(Lifecycle::Singleton);
+	container.registerType<IRequest, Request>(Lifecycle::Transient);
+
+	// 起動直後に全スレッドが一斉に解決する（Singleton の初回生成が競合する）
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 8; ++i) {
+		threads.emplace_back([&container]() {
+			for (int n = 0; n < 1000; ++n) {
+				container.resolve<IRequest>();
+				container.isRegistered<IConfig>();
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	// 呼び出し箇所ごとの取得回数・競合回数・待ち時間・保持時間
+	std::cout << container.lockProfile().toString();
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,74 @@
+//-------------------------------------------------------------
+//! @file   example20_trace.cpp
+//! @brief  TsukinoDIContainer 解決トレース使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IConfig
+//! @brief   設定インターフェース
+//-------------------------------------------------------------
+struct IConfig {
+	virtual ~IConfig() = default;
+};
+struct AppConfig : public IConfig {};
+
+//-------------------------------------------------------------
+//! @class   IDatabase
+//! @brief   データベースインターフェース（接続に時間がかかる）
+//-------------------------------------------------------------
+struct IDatabase {
+	virtual ~IDatabase() = default;
+};
+struct SqlDatabase : public IDatabase {
+	explicit SqlDatabase(std::shared_ptr<IConfig>) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+};
+
+//-------------------------------------------------------------
+//! @class   IRequestHandler
+//! @brief   リクエスト処理インターフェース
+//-------------------------------------------------------------
+struct IRequestHandler {
+	virtual ~IRequestHandler() = default;
+};
+struct RequestHandler : public IRequestHandler {
+	RequestHandler(std::shared_ptr<IDatabase>, std::shared_ptr<IConfig>) {}
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<IConfig, AppConfig>(Lifecycle::Singleton);
+	container.registerType<IDatabase, SqlDatabase>(Lifecycle::Scoped);
+	container.registerType<IRequestHandler, RequestHandler>(Lifecycle::Transient);
+
+	// トレースを有効にしてリクエストを処理
+	container.enableTracing(true);
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 2; ++i) {
+		threads.emplace_back([&container]() {
+			auto scope = container.createScope();
+			scope.resolve<IDatabase>();				// スコープ内の接続（遅い）
+			container.resolve<IRequestHandler>();	// 依存の連鎖
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	container.enableTracing(false);
+
+	// Perfetto (https://ui.perfetto.dev) や chrome://tracing で開ける
+	const char* path = "resolve_trace.json";
+	if (TsukinoDIContainer::ResolveTrace::writeChromeJson(path)) {
+		std::cout << "Trace written to " << path << std::endl;
+	}
+	std::cout << TsukinoDIContainer::ResolveTrace::toChromeJson().substr(0, 160) << "..." << std::endl;
+	TsukinoDIContainer::ResolveTrace::clear();
+	// プログラムの終了
+	return 0;
+}
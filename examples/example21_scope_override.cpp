@@ -0,0 +1,93 @@
+//-------------------------------------------------------------
+//! @file   example21_scope_override.cpp
+//! @brief  TsukinoDIContainer スコープ内の差し替え使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   ITenant
+//! @brief   テナント情報インターフェース（リクエストごとに異なる値）
+//-------------------------------------------------------------
+struct ITenant {
+	virtual ~ITenant() = default;
+	virtual std::string id() const = 0;
+};
+struct DefaultTenant : public ITenant {
+	std::string id() const override { return "default"; }
+};
+struct RequestTenant : public ITenant {
+	explicit RequestTenant(std::string id) : id_(std::move(id)) {}
+	std::string id() const override { return id_; }
+	std::string id_;
+};
+
+//-------------------------------------------------------------
+//! @class   IClock
+//! @brief   時刻インターフェース（テストダブルで差し替える）
+//-------------------------------------------------------------
+struct IClock {
+	virtual ~IClock() = default;
+	virtual int now() const = 0;
+};
+struct SystemClock : public IClock {
+	int now() const override { return 1000; }
+};
+struct FixedClock : public IClock {
+	int now() const override { return 0; }
+};
+
+//-------------------------------------------------------------
+//! @class   IOrderService
+//! @brief   注文サービスインターフェース
+//-------------------------------------------------------------
+struct IOrderService {
+	virtual ~IOrderService() = default;
+	virtual std::string describe() const = 0;
+};
+struct OrderService : public IOrderService {
+	OrderService(std::shared_ptr<ITenant> tenant, std::shared_ptr<IClock> clock)
+		: tenant_(std::move(tenant)), clock_(std::move(clock)) {
+	}
+	std::string describe() const override { return "tenant=" + tenant_->id() + " time=" + std::to_string(clock_->now()); }
+	std::shared_ptr<ITenant> tenant_;
+	std::shared_ptr<IClock> clock_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<ITenant, DefaultTenant>(Lifecycle::Singleton);
+	container.registerType<IClock, SystemClock>(Lifecycle::Singleton);
+	container.registerType<IOrderService, OrderService>(Lifecycle::Transient);
+
+	// リクエストごとにテナントを差し替え（コンテナの登録表は変更しない）
+	std::vector<std::thread> requests;
+	for (const char* tenant : { "alpha", "beta" }) {
+		requests.emplace_back([&container, tenant]() {
+			auto scope = container.createScope();
+			scope.override<ITenant>(std::make_shared<RequestTenant>(tenant));
+			std::cout << scope.resolve<IOrderService>()->describe() + "\n";
+		});
+	}
+	for (auto& request : requests) {
+		request.join();
+	}
+
+	// テストダブルへの差し替え（実装型を指定、依存はコンストラクタから推論）
+	{
+		auto scope = container.createScope();
+		scope.overrideType<IClock, FixedClock>();
+		std::cout << scope.resolve<IOrderService>()->describe() << std::endl;
+	}
+
+	// スコープ外は登録どおり
+	std::cout << container.resolve<IOrderService>()->describe() << std::endl;
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------
+//! @file   example22_fork.cpp
+//! @brief  TsukinoDIContainer 子コンテナ（fork）使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IConnectionPool
+//! @brief   接続プールインターフェース（全テナントで共有）
+//-------------------------------------------------------------
+struct IConnectionPool {
+	virtual ~IConnectionPool() = default;
+};
+struct ConnectionPool : public IConnectionPool {
+	ConnectionPool() { std::cout << "ConnectionPool constructed" << std::endl; }
+};
+
+//-------------------------------------------------------------
+//! @class   IBranding
+//! @brief   テナントごとの表示設定インターフェース
+//-------------------------------------------------------------
+struct IBranding {
+	virtual ~IBranding() = default;
+	virtual std::string title() const = 0;
+};
+struct DefaultBranding : public IBranding {
+	std::string title() const override { return "Default"; }
+};
+struct AcmeBranding : public IBranding {
+	std::string title() const override { return "ACME Corp."; }
+};
+
+//-------------------------------------------------------------
+//! @class   IPageRenderer
+//! @brief   ページ描画インターフェース
+//-------------------------------------------------------------
+struct IPageRenderer {
+	virtual ~IPageRenderer() = default;
+	virtual std::string render() const = 0;
+};
+struct PageRenderer : public IPageRenderer {
+	PageRenderer(std::shared_ptr<IConnectionPool> pool, std::shared_ptr<IBranding> branding)
+		: pool_(std::move(pool)), branding_(std::move(branding)) {
+	}
+	std::string render() const override { return "<h1>" + branding_->title() + "</h1>"; }
+	std::shared_ptr<IConnectionPool> pool_;
+	std::shared_ptr<IBranding> branding_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+
+	// 全テナント共通の登録（子が親を保持するため、fork 元は shared_ptr で所有する）
+	auto base = std::make_shared<TsukinoDIContainer::Container>();
+	base->registerType<IConnectionPool, ConnectionPool>(Lifecycle::Singleton);
+	base->registerType<IBranding, DefaultBranding>(Lifecycle::Singleton);
+	base->registerType<IPageRenderer, PageRenderer>(Lifecycle::Transient);
+
+	// テナントごとに fork（登録表は複製しない）し、差分だけ登録する
+	std::vector<std::unique_ptr<TsukinoDIContainer::Container>> tenants;
+	tenants.push_back(base->fork());	// 差分なし
+	tenants.push_back(base->fork());
+	tenants.back()->registerType<IBranding, AcmeBranding>(Lifecycle::Singleton);	// 親に登録済みでも子だけの上書き
+
+	for (const auto& tenant : tenants) {
+		auto renderer = std::static_pointer_cast<PageRenderer>(tenant->resolve<IPageRenderer>());
+		// 共有の Singleton は親が保持するため、全テナントで同じインスタンス
+		std::cout << renderer->render() << " pool shared: "
+			<< (renderer->pool_ == base->resolve<IConnectionPool>() ? "yes" : "no") << std::endl;
+	}
+
+	// 子の登録を含めた全体を検証できる
+	std::cout << "Tenant valid: " << (tenants.back()->validate().ok() ? "yes" : "no") << std::endl;
+
+	// 解決キャッシュが温まった後でも、子での登録は親の登録を隠す
+	auto late = base->fork();
+	late->enableResolveCache(true);
+	std::cout << "Before override: " << late->resolve<IBranding>()->title() << std::endl;
+	late->registerType<IBranding, AcmeBranding>(Lifecycle::Singleton);
+	std::cout << "After override: " << late->resolve<IBranding>()->title() << std::endl;
+
+	// 子が生存している間は親の登録を変更できない（全テナントの解決結果が黙って変わるため）
+	try {
+		base->replaceType<IBranding, AcmeBranding>(Lifecycle::Singleton);
+	}
+	catch (const TsukinoDIContainer::ResolveException& e) {
+		std::cout << "Parent locked: " << e.what() << std::endl;
+	}
+
+	// 親を先に手放しても、子が保持しているため子の破棄まで生存する
+	base.reset();
+	std::cout << "After parent released: " << tenants.front()->resolve<IPageRenderer>()->render() << std::endl;
+
+	// プログラムの終了
+	late.reset();
+	tenants.clear();
+	return 0;
+}
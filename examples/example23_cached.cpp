@@ -0,0 +1,87 @@
+//-------------------------------------------------------------
+//! @file   example23_cached.cpp
+//! @brief  TsukinoDIContainer Cached ライフサイクル使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IRouteTable
+//! @brief   経路表インターフェース（大きいが再構築できる）
+//-------------------------------------------------------------
+struct IRouteTable {
+	virtual ~IRouteTable() = default;
+	virtual std::size_t size() const = 0;
+};
+struct RouteTable : public IRouteTable {
+	RouteTable() : routes_(100000) { std::cout << "RouteTable built" << std::endl; }
+	std::size_t size() const override { return routes_.size(); }
+	// 保持するメモリの見積もり（Cached の合計サイズの計算に使われる）
+	std::size_t cacheSize() const { return sizeof(*this) + routes_.capacity() * sizeof(int); }
+	std::vector<int> routes_;
+};
+
+//-------------------------------------------------------------
+//! @class   ITemplateSet
+//! @brief   コンパイル済みテンプレートインターフェース
+//-------------------------------------------------------------
+struct ITemplateSet {
+	virtual ~ITemplateSet() = default;
+};
+struct TemplateSet : public ITemplateSet {
+	TemplateSet() : compiled_(300000, 'x') { std::cout << "TemplateSet built" << std::endl; }
+	std::size_t cacheSize() const { return sizeof(*this) + compiled_.capacity(); }
+	std::string compiled_;
+};
+
+// 保持状況の表示
+static void printStats(const TsukinoDIContainer::Container& container) {
+	const auto stats = container.cacheStats();
+	std::cout << "  entries=" << stats.entries_ << " bytes=" << stats.bytes_
+		<< " hits=" << stats.hits_ << " misses=" << stats.misses_
+		<< " evictions=" << stats.evictions_ << " expirations=" << stats.expirations_ << std::endl;
+}
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<IRouteTable, RouteTable>(Lifecycle::Cached);
+	container.registerType<ITemplateSet, TemplateSet>(Lifecycle::Cached);
+
+	// 合計 500KB まで、構築から 200ms まで保持する
+	TsukinoDIContainer::CachePolicy policy;
+	policy.byteBudget_ = 500 * 1024;
+	policy.ttl_ = std::chrono::milliseconds(200);
+	container.setCachePolicy(policy);
+
+	std::cout << "Resolve twice (second is a hit):" << std::endl;
+	auto routes = container.resolve<IRouteTable>();
+	std::cout << "  same instance: " << (routes == container.resolve<IRouteTable>() ? "yes" : "no") << std::endl;
+	printStats(container);
+
+	// 両方は上限に収まらないため、最も長く参照されていない RouteTable が破棄される
+	std::cout << "Resolve TemplateSet (over budget):" << std::endl;
+	container.resolve<ITemplateSet>();
+	printStats(container);
+
+	// 破棄後も解決済みのインスタンスは有効、次の解決で再構築される
+	std::cout << "Held instance still usable: " << routes->size() << " routes" << std::endl;
+	std::cout << "Resolve RouteTable again:" << std::endl;
+	container.resolve<IRouteTable>();
+	printStats(container);
+
+	// 保持期間を過ぎると次の解決で再構築される
+	std::this_thread::sleep_for(std::chrono::milliseconds(250));
+	std::cout << "After TTL:" << std::endl;
+	container.resolve<IRouteTable>();
+	printStats(container);
+	// プログラムの終了
+	return 0;
+}
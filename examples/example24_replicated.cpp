@@ -0,0 +1,67 @@
+//-------------------------------------------------------------
+//! @file   example24_replicated.cpp
+//! @brief  TsukinoDIContainer Replicated ライフサイクル使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+// 経路表の元データの版（更新されると refreshReplicas で全レプリカを作り直す）
+static std::atomic<int> g_routeVersion{ 1 };
+
+//-------------------------------------------------------------
+//! @class   IRoutingTable
+//! @brief   読み取り中心の経路表インターフェース
+//-------------------------------------------------------------
+struct IRoutingTable {
+	virtual ~IRoutingTable() = default;
+	virtual int version() const = 0;
+};
+struct RoutingTable : public IRoutingTable {
+	RoutingTable() : version_(g_routeVersion.load()) {}
+	int version() const override { return version_; }
+	const int version_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	using TsukinoDIContainer::CpuTopology;
+	std::cout << "CPUs: " << CpuTopology::cpuCount() << ", NUMA nodes: " << CpuTopology::nodeCount() << std::endl;
+
+	TsukinoDIContainer::Container container;
+	container.registerType<IRoutingTable, RoutingTable>(Lifecycle::Replicated);
+
+	// NUMA ノードごと（既定）: 同じノードのスレッドは同じインスタンスを共有する
+	auto a = container.resolve<IRoutingTable>();
+	auto b = container.resolve<IRoutingTable>();
+	std::cout << "Same node shares replica: " << ((a == b || CpuTopology::nodeCount() > 1) ? "yes" : "no") << std::endl;
+
+	// 元データを更新し、全レプリカを一斉に作り直す（以降の解決で古い版は返らない）
+	g_routeVersion = 2;
+	container.refreshReplicas<IRoutingTable>();
+
+	// CPU ごとに切り替えて複数スレッドから解決する
+	container.setReplicaGranularity<IRoutingTable>(TsukinoDIContainer::ReplicaGranularity::Cpu);
+	std::atomic<bool> stale{ false };
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 4; ++i) {
+		threads.emplace_back([&] {
+			for (int n = 0; n < 1000; ++n) {
+				if (container.resolve<IRoutingTable>()->version() != 2) stale = true;
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+	std::cout << "All threads saw version 2: " << (stale ? "no" : "yes") << std::endl;
+	std::cout << "Old replica still usable: version " << a->version() << std::endl;
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------
+//! @file   example25_generic.cpp
+//! @brief  TsukinoDIContainer オープンジェネリック登録使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IRepository
+//! @brief   エンティティ型ごとのリポジトリインターフェース
+//-------------------------------------------------------------
+template<typename TEntity>
+struct IRepository {
+	virtual ~IRepository() = default;
+	virtual std::string describe() const = 0;
+};
+template<typename TEntity>
+struct Repository : public IRepository<TEntity> {
+	std::string describe() const override { return std::string("Repository<") + TEntity::kName + ">"; }
+};
+
+// エンティティ
+struct User { static constexpr const char* kName = "User"; };
+struct Order { static constexpr const char* kName = "Order"; };
+
+// IRepository<X> → Repository<X> の対応付け（グローバル名前空間で宣言）
+TSUKINO_DI_GENERIC(IRepository, Repository);
+
+//-------------------------------------------------------------
+//! @class   UserService
+//! @brief   IRepository<User> に依存するサービス
+//-------------------------------------------------------------
+struct UserService {
+	explicit UserService(std::shared_ptr<IRepository<User>> users) : users_(std::move(users)) {}
+	std::shared_ptr<IRepository<User>> users_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+
+	// エンティティ型ごとの登録は不要（初回の要求で Repository<X> が登録される）
+	container.registerGeneric<IRepository, Repository>(Lifecycle::Singleton);
+	container.registerType<UserService, UserService>(Lifecycle::Transient);
+
+	// 依存として要求された IRepository<User> も解決できる
+	auto service = container.resolve<UserService>();
+	std::cout << "UserService uses: " << service->users_->describe() << std::endl;
+
+	// 直接解決した IRepository<Order>、同じ Singleton の IRepository<User>
+	auto orders = container.resolve<IRepository<Order>>();
+	std::cout << "Resolved: " << orders->describe() << std::endl;
+	std::cout << "Same singleton: " << (service->users_ == container.resolve<IRepository<User>>() ? "yes" : "no") << std::endl;
+
+	// インスタンス化済みの型は通常の登録として検証・グラフの対象になる
+	std::cout << "Validation: " << (container.validate().ok() ? "OK" : "NG") << std::endl;
+	return 0;
+}
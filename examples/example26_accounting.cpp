@@ -0,0 +1,63 @@
+//-------------------------------------------------------------
+//! @file   example26_accounting.cpp
+//! @brief  TsukinoDIContainer インスタンス計上使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//! @details TSUKINO_DI_INSTANCE_ACCOUNTING=1 でライブラリごとビルドした場合に計上結果が表示される
+//!          （CMake では -DTSUKINO_DI_INSTANCE_ACCOUNTING=ON）
+//-------------------------------------------------------------
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IBuffer
+//! @brief   バッファインターフェース
+//-------------------------------------------------------------
+struct IBuffer {
+	virtual ~IBuffer() = default;
+};
+struct Buffer : public IBuffer {
+	Buffer() : data_(4096) {}
+	std::size_t cacheSize() const { return sizeof(*this) + data_.capacity(); }	// 内部で確保した領域も申告
+	std::vector<char> data_;
+};
+
+//-------------------------------------------------------------
+//! @class   IRequest
+//! @brief   リクエストインターフェース
+//-------------------------------------------------------------
+struct IRequest {
+	virtual ~IRequest() = default;
+};
+struct Request : public IRequest {
+	explicit Request(std::shared_ptr<IBuffer> buffer) : buffer_(std::move(buffer)) {}
+	std::shared_ptr<IBuffer> buffer_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<IBuffer, Buffer>(Lifecycle::Transient);
+	container.registerType<IRequest, Request>(Lifecycle::Scoped);
+
+	// スコープの外へ持ち出したインスタンス（スコープ終了後も生き残る）
+	std::vector<std::shared_ptr<IRequest>> leaked;
+	for (int i = 0; i < 3; ++i) {
+		TsukinoDIContainer::ScopedContext scope(container);
+		auto request = scope.resolve<IRequest>();
+		if (i == 0) {
+			leaked.push_back(request);
+		}
+		// スコープ内で構築した数（Request と依存の Buffer）
+		if (i == 2) {
+			std::cout << "Scope:\n" << scope.instanceAccounting().toString();
+		}
+	}
+
+	// 型ごとの構築数・生存数・概算サイズ（Request / Buffer が 1 つずつ生き残っている）
+	std::cout << "Container:\n" << container.instanceAccounting().toString();
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,68 @@
+//-------------------------------------------------------------
+//! @file   example27_typeid.cpp
+//! @brief  TsukinoDIContainer 型識別子（RTTI 不要）使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//! @details -fno-rtti でもビルドできる（CMake では -DTSUKINO_DI_NO_RTTI=ON）。
+//!          RTTI が有効なビルドでは std::type_index からの解決も示す。
+//-------------------------------------------------------------
+#include <iostream>
+#include <memory>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+namespace app {
+	//-------------------------------------------------------------
+	//! @class   IClock
+	//! @brief   時刻インターフェース
+	//-------------------------------------------------------------
+	struct IClock {
+		virtual ~IClock() = default;
+		virtual long now() const = 0;
+	};
+	struct FixedClock : public IClock {
+		long now() const override { return 42; }
+	};
+
+	//-------------------------------------------------------------
+	//! @class   IScheduler
+	//! @brief   スケジューラインターフェース（未登録の依存を持つ）
+	//-------------------------------------------------------------
+	struct IScheduler {
+		virtual ~IScheduler() = default;
+	};
+}
+
+// 型名とそのハッシュはコンパイル時に決まる
+static_assert(TsukinoDIContainer::typeId<app::IClock>().hash_code() != TsukinoDIContainer::typeId<app::IScheduler>().hash_code(), "distinct type names");
+#if TSUKINO_DI_TYPE_ID_HASHED
+// ハッシュで比較する設定では識別子の比較もコンパイル時に行える（既定のアドレス比較は実行時のみ保証）
+static_assert(TsukinoDIContainer::typeId<app::IClock>() != TsukinoDIContainer::typeId<app::IScheduler>(), "distinct types");
+static_assert(TsukinoDIContainer::typeId<const app::IClock>() == TsukinoDIContainer::typeId<app::IClock>(), "cv is ignored");
+#endif
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<app::IClock, app::FixedClock>(Lifecycle::Singleton);
+
+	// 診断に使う型名（デマングル不要）
+	std::cout << "Type name: " << TsukinoDIContainer::typeId<app::IClock>().name() << std::endl;
+	std::cout << "Resolved: " << container.resolve<app::IClock>()->now() << std::endl;
+
+	// エラーメッセージもコンパイル時の型名で組み立てられる
+	try {
+		container.resolve<app::IScheduler>();
+	}
+	catch (const TsukinoDIContainer::ResolveException& e) {
+		std::cout << "[Error] " << e.what() << std::endl;
+	}
+
+#if TSUKINO_DI_TYPE_INDEX
+	// 動的に得た型（std::type_index）からの解決（登録済みの型のみ）
+	auto clock = std::static_pointer_cast<app::IClock>(container.resolveByKey(std::type_index(typeid(app::IClock))));
+	std::cout << "Resolved by type_index: " << clock->now() << std::endl;
+#else
+	std::cout << "Built without RTTI" << std::endl;
+#endif
+	return 0;
+}
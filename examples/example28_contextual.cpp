@@ -0,0 +1,80 @@
+//-------------------------------------------------------------
+//! @file   example28_contextual.cpp
+//! @brief  TsukinoDIContainer コンテキスト束縛使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <memory>
+#include <string>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   ILogger
+//! @brief   ロガーインターフェース
+//-------------------------------------------------------------
+struct ILogger {
+	virtual ~ILogger() = default;
+	virtual std::string name() const = 0;
+};
+struct ConsoleLogger : public ILogger {
+	std::string name() const override { return "ConsoleLogger"; }
+};
+struct AuditLogger : public ILogger {
+	std::string name() const override { return "AuditLogger"; }
+};
+
+//-------------------------------------------------------------
+//! @class   IOrderService
+//! @brief   注文サービスインターフェース（監査ログが必要）
+//-------------------------------------------------------------
+struct IOrderService {
+	virtual ~IOrderService() = default;
+	virtual std::string loggerName() const = 0;
+};
+struct OrderService : public IOrderService {
+	explicit OrderService(std::shared_ptr<ILogger> logger) : logger_(std::move(logger)) {}
+	std::string loggerName() const override { return logger_->name(); }
+	std::shared_ptr<ILogger> logger_;
+};
+
+//-------------------------------------------------------------
+//! @class   ICatalogService
+//! @brief   カタログサービスインターフェース（通常のロガー）
+//-------------------------------------------------------------
+struct ICatalogService {
+	virtual ~ICatalogService() = default;
+	virtual std::string loggerName() const = 0;
+};
+struct CatalogService : public ICatalogService {
+	explicit CatalogService(std::shared_ptr<ILogger> logger) : logger_(std::move(logger)) {}
+	std::string loggerName() const override { return logger_->name(); }
+	std::shared_ptr<ILogger> logger_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<ILogger, ConsoleLogger>(Lifecycle::Singleton);
+	container.registerType<IOrderService, OrderService>();
+	container.registerType<ICatalogService, CatalogService>();
+
+	// IOrderService が ILogger を要求した場合だけ AuditLogger を渡す（依存の置き換えは登録時に 1 回）
+	container.registerContextual<IOrderService, ILogger, AuditLogger>(Lifecycle::Singleton);
+
+	std::cout << "OrderService uses " << container.resolve<IOrderService>()->loggerName() << std::endl;
+	std::cout << "CatalogService uses " << container.resolve<ICatalogService>()->loggerName() << std::endl;
+	std::cout << "ILogger resolves to " << container.resolve<ILogger>()->name() << std::endl;
+
+	// 同じ辺の束縛は 1 つだけ
+	try {
+		container.registerContextual<IOrderService, ILogger, ConsoleLogger>();
+	}
+	catch (const TsukinoDIContainer::ResolveException& e) {
+		std::cout << "[Error] " << e.what() << std::endl;
+	}
+
+	// 依存グラフでは消費側ごとの辺として現れる
+	std::cout << (container.validate().ok() ? "Validation passed" : "Validation failed") << std::endl;
+	return 0;
+}
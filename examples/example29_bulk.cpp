@@ -0,0 +1,58 @@
+//-------------------------------------------------------------
+//! @file   example29_bulk.cpp
+//! @brief  TsukinoDIContainer Transient 一括解決使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+//-------------------------------------------------------------
+//! @class   IRandom
+//! @brief   乱数インターフェース（パーティクルが共有する依存）
+//-------------------------------------------------------------
+struct IRandom {
+	virtual ~IRandom() = default;
+	virtual int next() = 0;
+};
+struct CounterRandom : public IRandom {
+	int next() override { return ++value_; }
+	int value_ = 0;
+};
+
+//-------------------------------------------------------------
+//! @class   IParticle
+//! @brief   パーティクルインターフェース（大量に生成する Transient）
+//-------------------------------------------------------------
+struct IParticle {
+	virtual ~IParticle() = default;
+	virtual int seed() const = 0;
+};
+struct Particle : public IParticle {
+	explicit Particle(std::shared_ptr<IRandom> random) : seed_(random->next()) {}
+	int seed() const override { return seed_; }
+	int seed_;
+};
+
+// エントリポイント
+int main() {
+	using TsukinoDIContainer::Lifecycle;
+	TsukinoDIContainer::Container container;
+	container.registerType<IRandom, CounterRandom>(Lifecycle::Singleton);
+	container.registerType<IParticle, Particle>();
+
+	// 登録の検索と依存の解決は 1 回、1000 件を 1 つの連続領域に構築
+	std::vector<std::shared_ptr<IParticle>> particles = container.resolveN<IParticle>(1000);
+	std::cout << "Created " << particles.size() << " particles" << std::endl;
+	std::cout << "First seed " << particles.front()->seed() << ", last seed " << particles.back()->seed() << std::endl;
+	std::cout << "Contiguous: " << (reinterpret_cast<const char*>(particles[1].get()) - reinterpret_cast<const char*>(particles[0].get()) == static_cast<std::ptrdiff_t>(sizeof(Particle)) ? "yes" : "no") << std::endl;
+
+	// 全てのインスタンスは制御ブロックを共有する（最後の 1 件が破棄されたときに領域を解放）
+	std::cout << "Shared owners: " << particles.front().use_count() << std::endl;
+
+	// Transient 以外は resolve を繰り返すのと同じ
+	auto randoms = container.resolveN<IRandom>(3);
+	std::cout << "Singleton shared: " << (randoms[0] == randoms[2] ? "yes" : "no") << std::endl;
+	return 0;
+}
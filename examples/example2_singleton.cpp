@@ -1,74 +1,74 @@
 //-------------------------------------------------------------
 //! @file   example2_singleton.cpp
-//! @brief  TsukinoDIContainer SingletonCtTCNgp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer Singletonライフサイクル使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 //-------------------------------------------------------------
 //! @class   ICounterService
-//! @brief   JE^[T[rXC^[tF[X
+//! @brief   カウンターサービスインターフェース
 //-------------------------------------------------------------
 struct ICounterService {
     //-------------------------------------------------------------
-	//! @brief   JE^[CNg֐
-	//! @note    z֐
+	//! @brief   カウンターをインクリメントする関数
+	//! @note    純粋仮想関数
     //-------------------------------------------------------------
     virtual void increment() = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   JE^[̌ݒl擾֐
-	//! @note    z֐
-	//! @return  JE^[̌ݒl
-	//! @note    z֐
+	//! @brief   カウンターの現在値を取得する関数
+	//! @note    純粋仮想関数
+	//! @return  カウンターの現在値
+	//! @note    純粋仮想関数
 	//-------------------------------------------------------------
     virtual int getValue() const = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   zfXgN^
+	//! @brief   仮想デストラクタ
 	//-------------------------------------------------------------
     virtual ~ICounterService() = default;
 };
 
 //-------------------------------------------------------------
 //! @class   CounterService
-//! @brief   JE^[T[rX
+//! @brief   カウンターサービス実装
 //-------------------------------------------------------------
 struct CounterService : public ICounterService {
-	int value_ = 0;  // JE^[̓
+	int value_ = 0;  // カウンターの内部状態
 
 	//-------------------------------------------------------------
-	//! @brief   JE^[CNg֐
+	//! @brief   カウンターをインクリメントする関数実装
 	//-------------------------------------------------------------
     void increment() override { ++value_; }
 
 	//-------------------------------------------------------------
-	//! @brief   JE^[̌ݒl擾֐
-	// @return  JE^[̌ݒl
+	//! @brief   カウンターの現在値を取得する関数実装
+	// @return  カウンターの現在値
 	//-------------------------------------------------------------
     int getValue() const override { return value_; }
 };
 
-// Gg|Cg
+// エントリポイント
 int main() {
-	// Rei
+	// コンテナ生成
     TsukinoDIContainer::Container container;
 
-    // Singleton CtTCNœo^
+    // Singleton ライフサイクルで登録
     container.registerType<ICounterService, CounterService>(TsukinoDIContainer::Lifecycle::Singleton);
 
-    // 1ڂ̉
+    // 1回目の解決
     auto counter1 = container.resolve<ICounterService>();
     counter1->increment();
     std::cout << "Counter1 value: " << counter1->getValue() << std::endl;
 
-    // 2ڂ̉iCX^XԂj
+    // 2回目の解決（同じインスタンスが返る）
     auto counter2 = container.resolve<ICounterService>();
     counter2->increment();
     std::cout << "Counter2 value: " << counter2->getValue() << std::endl;
 
-    // counter1counter2͓CX^XwĂ̂Œl͋L
+    // counter1とcounter2は同じインスタンスを指しているので値は共有される
     std::cout << "Counter1 value (after counter2 increment): " << counter1->getValue() << std::endl;
-	// vȌI
+	// プログラムの終了
     return 0;
 }
@@ -1,84 +1,84 @@
 //-------------------------------------------------------------
 //! @file   example3_scoped.cpp
-//! @brief  TsukinoDIContainer ScopedCtTCNgp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer Scopedライフサイクル使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 //-------------------------------------------------------------
 //! @class   ISessionService
-//! @brief   ZbVT[rXC^[tF[X
+//! @brief   セッションサービスインターフェース
 //-------------------------------------------------------------
 struct ISessionService {
 	//-------------------------------------------------------------
-	//! @brief   lݒ肷֐
+	//! @brief   値を設定する関数
 	//-------------------------------------------------------------
 	virtual void setValue(int v) = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   l擾֐
+	//! @brief   値を取得する関数
 	//-------------------------------------------------------------
 	virtual int getValue() const = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   zfXgN^
+	//! @brief   仮想デストラクタ
 	//-------------------------------------------------------------
 	virtual ~ISessionService() = default;
 };
 
 //-------------------------------------------------------------
 //! @class   SessionService
-//! @brief   ZbVT[rX
+//! @brief   セッションサービス実装
 //-------------------------------------------------------------
 struct SessionService : public ISessionService {
-	int value_ = 0;  // 
+	int value_ = 0;  // 内部状態
 
 	//-------------------------------------------------------------
-	//! @brief   lݒ肷֐
-	//! @param   v [in] ݒ肷l
+	//! @brief   値を設定する関数実装
+	//! @param   v [in] 設定する値
 	//-------------------------------------------------------------
 	void setValue(int v) override { value_ = v; }
 
 	//-------------------------------------------------------------
-	//! @brief   l擾֐
-	//! @return  ݒ肳ꂽl
+	//! @brief   値を取得する関数実装
+	//! @return  設定された値
 	//-------------------------------------------------------------
 	int getValue() const override { return value_; }
 };
 
-// Gg|Cg
+// エントリポイント
 int main() {
-	// Rei
+	// コンテナ生成
 	TsukinoDIContainer::Container container;
 
-	// Scoped CtTCNœo^
+	// Scoped ライフサイクルで登録
 	container.registerType<ISessionService, SessionService>(TsukinoDIContainer::Lifecycle::Scoped);
 
-	// XR[v1Jn
+	// スコープ1開始
 	{
-		auto scope1 = container.createScope();          // XR[vJn
-		auto s1a = scope1.resolve<ISessionService>();   // XR[vŉ
-		s1a->setValue(42);                              // lݒ
-		// XR[vōēx
+		auto scope1 = container.createScope();          // スコープ開始
+		auto s1a = scope1.resolve<ISessionService>();   // スコープ内で解決
+		s1a->setValue(42);                              // 値を設定
+		// 同じスコープ内で再度解決
 		auto s1b = scope1.resolve<ISessionService>();
-		// s1as1b͓CX^X
+		// s1aとs1bは同じインスタンス
 		std::cout << "Scope1 values: " << s1a->getValue() << ", " << s1b->getValue() << std::endl;
-		// s1a  s1b ͓CX^XL
-	}// XR[v1IiRAIIȂ̂ŃCX^X͔jj
+		// s1a と s1b は同じインスタンスを共有
+	}// スコープ1終了（RAIIなのでインスタンスは破棄される）
 
-	// XR[v2JniVCX^Xj
+	// スコープ2開始（新しいインスタンスが生成される）
 	{
-		auto scope2 = container.createScope();          // XR[vJn
-		auto s2a = scope2.resolve<ISessionService>();   // XR[vŉ
-		// ȑÕXR[vƂ͕ʃCX^X
+		auto scope2 = container.createScope();          // スコープ開始
+		auto s2a = scope2.resolve<ISessionService>();   // スコープ内で解決
+		// 以前のスコープとは別インスタンス
 		std::cout << "Scope2 initial value: " << s2a->getValue() << std::endl;
 
-		s2a->setValue(99);  // lݒ
-		// XR[vōēx
+		s2a->setValue(99);  // 値を設定
+		// 同じスコープ内で再度解決
 		auto s2b = scope2.resolve<ISessionService>();
-		// s2as2b͓CX^X
+		// s2aとs2bは同じインスタンス
 		std::cout << "Scope2 values: " << s2a->getValue() << ", " << s2b->getValue() << std::endl;
-		// s2a  s2b ͓CX^XL
+		// s2a と s2b は同じインスタンスを共有
 	}
 
 	return 0;
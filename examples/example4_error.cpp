@@ -1,26 +1,26 @@
 //-------------------------------------------------------------
 //! @file   example4_error.cpp
-//! @brief  TsukinoDIContainer G[gp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer エラー処理使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 
 //-------------------------------------------------------------
 //! @class   IA
-//! @brief   zˑeXgpC^[tF[X A
+//! @brief   循環依存テスト用インターフェース A
 //-------------------------------------------------------------
 struct IA { virtual ~IA() = default; };
 
 //-------------------------------------------------------------
 //! @class   IB
-//! @brief   zˑeXgpC^[tF[X B
+//! @brief   循環依存テスト用インターフェース B
 //-------------------------------------------------------------
 struct IB { virtual ~IB() = default; };
 
 //-------------------------------------------------------------
 //! @class   AImpl
-//! @brief   IA ̎iIB Ɉˑj
+//! @brief   IA の実装（IB に依存）
 //-------------------------------------------------------------
 struct AImpl : public IA {
     explicit AImpl(std::shared_ptr<IB>) {}
@@ -28,7 +28,7 @@ struct AImpl : public IA {
 
 //-------------------------------------------------------------
 //! @class   BImpl
-//! @brief   IB ̎iIA Ɉˑj
+//! @brief   IB の実装（IA に依存）
 //-------------------------------------------------------------
 struct BImpl : public IB {
     explicit BImpl(std::shared_ptr<IA>) {}
@@ -36,18 +36,18 @@ struct BImpl : public IB {
 
 //-------------------------------------------------------------
 //! @class   DummyService
-//! @brief   ˑȂ̃_~[T[rXiēo^eXgpj
+//! @brief   依存なしのダミーサービス（再登録テスト用）
 //-------------------------------------------------------------
 struct DummyService {
-    DummyService() {} // ftHgRXgN^
+    DummyService() {} // デフォルトコンストラクタあり
 };
 
-// Gg|Cg
+// エントリポイント
 int main() {
-	// Rei
+	// コンテナ生成
     TsukinoDIContainer::Container container;
 
-    // 1. o^^悤Ƃꍇ
+    // 1. 未登録型を解決しようとした場合
     try {
         auto unknown = container.resolve<int>();
     }
@@ -55,24 +55,44 @@ int main() {
         std::cerr << "[Error] " << ex.what() << std::endl;
     }
 
-    // 2. ɓo^ς݂̌^ēo^悤Ƃꍇ
+    // 2. 既に登録済みの型を再登録しようとした場合
     try {
         container.registerType<DummyService, DummyService>();
-        container.registerType<DummyService, DummyService>(); // 2ڂ̓G[
+        container.registerType<DummyService, DummyService>(); // 2回目はエラー
     }
     catch (const TsukinoDIContainer::ResolveException& ex) {
         std::cerr << "[Error] " << ex.what() << std::endl;
     }
 
-    // 3. zˑ悤Ƃꍇ
+    // 3. 循環依存を解決しようとした場合
     try {
         container.replaceCtor<IA, AImpl, IB>();
         container.replaceCtor<IB, BImpl, IA>();
-        auto a = container.resolve<IA>(); // zˑŃG[
+        auto a = container.resolve<IA>(); // 循環依存でエラー
     }
     catch (const TsukinoDIContainer::ResolveException& ex) {
         std::cerr << "[Error] " << ex.what() << std::endl;
     }
-	// vȌI
+
+    // 4. 例外を投げずに解決を試みる場合（任意の依存の取得など）
+    auto optional = container.tryResolve<int>();
+    if (!optional) {
+        std::cerr << "[tryResolve] not registered: "
+                  << (optional.error() == TsukinoDIContainer::ResolveErrorCode::NotRegistered)
+                  << " (" << TsukinoDIContainer::typeName(optional.errorType()) << ")" << std::endl;
+    }
+    auto dummy = container.tryResolve<DummyService>();
+    std::cerr << "[tryResolve] DummyService resolved: " << (dummy.value() != nullptr) << std::endl;
+
+    // 5. エラーコードで分岐する場合（メッセージは what() を呼ぶまで生成されない）
+    try {
+        container.resolve<IA>();
+    }
+    catch (const TsukinoDIContainer::ResolveException& ex) {
+        if (ex.code() == TsukinoDIContainer::ResolveErrorCode::CircularDependency) {
+            std::cerr << "[Error] cycle length " << ex.types().size() << std::endl;
+        }
+    }
+	// プログラムの終了
     return 0;
 }
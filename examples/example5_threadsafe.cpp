@@ -1,7 +1,7 @@
 //-------------------------------------------------------------
 //! @file   example5_threadsafe.cpp
-//! @brief  TsukinoDIContainer XbhZ[tgp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer スレッドセーフ使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <thread>
@@ -9,30 +9,30 @@
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 //-------------------------------------------------------------
 //! @class   IWorkerService
-//! @brief   [J[T[rXC^[tF[X
+//! @brief   ワーカーサービスインターフェース
 //-------------------------------------------------------------
 struct IWorkerService {
 	//-------------------------------------------------------------
-	//! @brief   񏈗֐
-	//! @param   id  [in] [J[ID
+	//! @brief   並列処理をする関数
+	//! @param   id  [in] ワーカーID
 	//-------------------------------------------------------------
 	virtual void doWork(int id) = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   zfXgN^
+	//! @brief   仮想デストラクタ
 	//-------------------------------------------------------------
 	virtual ~IWorkerService() = default;
 };
 
 //-------------------------------------------------------------
 //! @class   WorkerService
-//! @brief   [J[T[rX
+//! @brief   ワーカーサービス実装
 //-------------------------------------------------------------
 struct WorkerService : public IWorkerService {
 	//-------------------------------------------------------------
-	//! @brief   񏈗֐
-	//! @param   id  [in] [J[ID
-	//! @details [J[IDƃXbhID\
+	//! @brief   並列処理をする関数実装
+	//! @param   id  [in] ワーカーID
+	//! @details ワーカーIDとスレッドIDを表示
 	//-------------------------------------------------------------
 	void doWork(int id) override {
 		std::cout << "Worker " << id << " is working in thread "
@@ -40,30 +40,30 @@ struct WorkerService : public IWorkerService {
 	}
 };
 
-// Gg|Cg
+// エントリポイント
 int main() {
-	// Rei
+	// コンテナ生成
 	TsukinoDIContainer::Container container;
 
-	// TransientCtTCNœo^
+	// Transientライフサイクルで登録
 	container.registerType<IWorkerService, WorkerService>(TsukinoDIContainer::Lifecycle::Transient);
 
-	// Xbh Resolve Ăяo
+	// 複数スレッドで Resolve を呼び出す
 	const int threadCount = 5;
 	std::vector<std::thread> threads;
 
-	// Xbh
+	// スレッド生成
 	for (int i = 0; i < threadCount; ++i) {
 		threads.emplace_back([&, i]() {
-			auto worker = container.resolve<IWorkerService>();	// XbhZ[tɉ
-			worker->doWork(i);									// [Ns
+			auto worker = container.resolve<IWorkerService>();	// スレッドセーフに解決
+			worker->doWork(i);									// ワーク実行
 			});
 	}
 
-	// SXbhI҂
+	// 全スレッド終了待ち
 	for (auto& t : threads) {
-		t.join();	// Xbh̏I҂
+		t.join();	// スレッドの終了を待つ
 	}
-	// vȌI
+	// プログラムの終了
 	return 0;
 }
@@ -1,7 +1,7 @@
 //-------------------------------------------------------------
 //! @file   example6_scoped_multithread.cpp
-//! @brief  TsukinoDIContainer Scoped CtTCN + }`Xbhgp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer Scoped ライフサイクル + マルチスレッド使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <thread>
@@ -9,79 +9,79 @@
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 //-------------------------------------------------------------
 //! @class   ISessionService
-//! @brief   ZbVT[rXC^[tF[X
+//! @brief   セッションサービスインターフェース
 //-------------------------------------------------------------
 struct ISessionService {
 	//-------------------------------------------------------------
-	//! @brief   lݒ肷֐
-	//! @param   v [in] ݒ肷l
-	//! @note    z֐
+	//! @brief   値を設定する関数
+	//! @param   v [in] 設定する値
+	//! @note    純粋仮想関数
 	//-------------------------------------------------------------
 	virtual void setValue(int v) = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   l擾֐
-	//! @return  ݒ肳ꂽl
-	//! @note    z֐
+	//! @brief   値を取得する関数
+	//! @return  設定された値
+	//! @note    純粋仮想関数
 	//-------------------------------------------------------------
 	virtual int getValue() const = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   zfXgN^
+	//! @brief   仮想デストラクタ
 	//-------------------------------------------------------------
 	virtual ~ISessionService() = default;
 };
 
 //-------------------------------------------------------------
 //! @class   SessionService
-//! @brief   ZbVT[rX
+//! @brief   セッションサービス実装
 //-------------------------------------------------------------
 struct SessionService : public ISessionService {
-	int value_ = 0;	// 
+	int value_ = 0;	// 内部状態
 
 	//-------------------------------------------------------------
-	//! @brief   lݒ肷֐
-	//! @param   v [in] ݒ肷l
+	//! @brief   値を設定する関数実装
+	//! @param   v [in] 設定する値
 	//-------------------------------------------------------------
 	void setValue(int v) override { value_ = v; }
 
 	//-------------------------------------------------------------
-	//! @brief   l擾֐
-	//! @return  ݒ肳ꂽl
+	//! @brief   値を取得する関数実装
+	//! @return  設定された値
 	//-------------------------------------------------------------
 	int getValue() const override { return value_; }
 };
 
 //-------------------------------------------------------------
-//! @brief Gg|Cg
+//! @brief エントリポイント
 //-------------------------------------------------------------
 int main() {
-	// Rei
+	// コンテナ生成
 	TsukinoDIContainer::Container container;
 
-	// Scoped CtTCNœo^
+	// Scoped ライフサイクルで登録
 	container.registerType<ISessionService, SessionService>(TsukinoDIContainer::Lifecycle::Scoped);
 
-	// }`XbhŃXR[v𐶐ėp
+	// マルチスレッドでスコープを生成して利用
 	const int threadCount = 3;
 	std::vector<std::thread> threads;
 
-	// o͗p̔r 
+	// 出力用の排他制御 
 	static std::mutex cout_mutex;
 
-	// eXbhœƎ̃XR[v𐶐
+	// 各スレッドで独自のスコープを生成
 	for (int i = 0; i < threadCount; ++i) {
-		// Xbh
+		// スレッド生成
 		threads.emplace_back([&, i]() {
-			auto scope = container.createScope(); // XbhƂɃXR[v
-			// XR[vœ^2
+			auto scope = container.createScope(); // スレッドごとにスコープ生成
+			// スコープ内で同じ型を2回解決
 			auto s1 = scope.resolve<ISessionService>();
 			s1->setValue(i * 10);
-			// XR[vōēx
+			// 同じスコープ内で再度解決
 			auto s2 = scope.resolve<ISessionService>();
 			{
-				std::lock_guard<std::mutex> lock(cout_mutex); // o͂r
-				// XR[vŋLĂ邱ƂmF
+				std::lock_guard<std::mutex> lock(cout_mutex); // 出力を排他制御
+				// 同じスコープ内で共有されていることを確認
 				std::cout << "Thread " << i
 					<< " values: " << s1->getValue()
 					<< ", " << s2->getValue()
@@ -89,10 +89,10 @@ int main() {
 			}
 			});
 	}
-	// XbhIҋ@
+	// スレッド終了待機
 	for (auto& t : threads) {
 		t.join();
 	}
-	// vȌI
+	// プログラムの終了
 	return 0;
 }
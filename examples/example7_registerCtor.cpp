@@ -1,36 +1,36 @@
 //-------------------------------------------------------------
 //! @file   example7_registerCtor.cpp
-//! @brief  TsukinoDIContainer registerCtor gp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer registerCtor 使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 //-------------------------------------------------------------
 //! @class   ILogger
-//! @brief   K[C^[tF[X
+//! @brief   ロガーインターフェース
 //-------------------------------------------------------------
 struct ILogger {
     //-------------------------------------------------------------
-	//! @brief   Oo͊֐
-	//! @param   msg  [in] ObZ[W
-	//! @note    z֐
+	//! @brief   ログ出力関数
+	//! @param   msg  [in] ログメッセージ
+	//! @note    純粋仮想関数
     //-------------------------------------------------------------
     virtual void log(const std::string& msg) = 0;
 
     //-------------------------------------------------------------
-	//! @brief   zfXgN^
+	//! @brief   仮想デストラクタ
     //-------------------------------------------------------------
     virtual ~ILogger() = default;
 };
 
 //-------------------------------------------------------------
 //! @class   ConsoleLogger
-//! @brief   R\[K[
+//! @brief   コンソールロガー実装
 //-------------------------------------------------------------
 struct ConsoleLogger : public ILogger {
     //-------------------------------------------------------------
-	//! @brief   Oo͊֐
-	//! @param   msg  [in] ObZ[W
+	//! @brief   ログ出力関数実装
+	//! @param   msg  [in] ログメッセージ
     //-------------------------------------------------------------
     void log(const std::string& msg) override {
         std::cout << "[ConsoleLogger] " << msg << std::endl;
@@ -39,41 +39,41 @@ struct ConsoleLogger : public ILogger {
 
 //-------------------------------------------------------------
 //! @class   Service
-//! @brief   K[ɈˑT[rX
+//! @brief   ロガーに依存するサービス
 //-------------------------------------------------------------
 struct Service {
     //-------------------------------------------------------------
-	//! @brief   RXgN^iILogger Ɉˑj
-	//! @param   logger  [in] K[CX^X
-	//! @details registerCtor gĈˑ֌Wtœo^
+	//! @brief   コンストラクタ（ILogger に依存）
+	//! @param   logger  [in] ロガーインスタンス
+	//! @details registerCtor を使って依存関係付きで登録
     //-------------------------------------------------------------
     explicit Service(std::shared_ptr<ILogger> logger) : logger_(std::move(logger)) {}
 
     //-------------------------------------------------------------
-	//! @brief   T[rXs֐
+	//! @brief   サービス実行関数
     //-------------------------------------------------------------
     void run() { logger_->log("Service is running"); }
 private:
-	std::shared_ptr<ILogger> logger_;   // ˑ郍K[CX^X
+	std::shared_ptr<ILogger> logger_;   // 依存するロガーインスタンス
 };
 
-// Gg|Cg
+// エントリポイント
 int main() {
-	// Rei
+	// コンテナ生成
     TsukinoDIContainer::Container container;
 
-    // 1) ˑ ILogger ɓo^iSingleton ŋLj
+    // 1) 依存先 ILogger を先に登録（Singleton で共有）
     container.registerType<ILogger, ConsoleLogger>(TsukinoDIContainer::Lifecycle::Singleton);
 
-    // 2) ˑ֌Wt Service VKo^iILogger Ɉˑj
-    //     Service o^ĂOňSɎs܂
+    // 2) 依存関係付きで Service を新規登録（ILogger に依存）
+    //    既に Service が登録されていたら例外で安全に失敗します
     container.registerCtor<Service, Service, ILogger>(TsukinoDIContainer::Lifecycle::Transient);
 
-    // 3) Ďs
+    // 3) 解決して実行
     auto service = container.resolve<Service>();
     service->run();
 
-    // 4) do^̌piOj
+    // 4) 重複登録の誤用を示す（例外）
     try {
         container.registerCtor<Service, Service, ILogger>(TsukinoDIContainer::Lifecycle::Transient);
     }
@@ -1,37 +1,37 @@
 //-------------------------------------------------------------
 //! @file   example8_mock.cpp
-//! @brief  TsukinoDIContainer bNgp
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  TsukinoDIContainer モック注入使用例
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include <iostream>
 #include <TsukinoDIContainer/TsukinoDIContainer.hpp>
 //-------------------------------------------------------------
 //! @class   ILogger
-//! @brief   K[C^[tF[X
+//! @brief   ロガーインターフェース
 //-------------------------------------------------------------
 struct ILogger {
 	//-------------------------------------------------------------
-	//! @brief   Oo͊֐
-	//! @param   msg  [in] ObZ[W
-	//! @note    z֐
+	//! @brief   ログ出力関数
+	//! @param   msg  [in] ログメッセージ
+	//! @note    純粋仮想関数
 	//-------------------------------------------------------------
 	virtual void log(const std::string& msg) = 0;
 
 	//-------------------------------------------------------------
-	//! @brief   zfXgN^
+	//! @brief   仮想デストラクタ
 	//-------------------------------------------------------------
 	virtual ~ILogger() = default;
 };
 
 //-------------------------------------------------------------
 //! @class   ConsoleLogger
-//! @brief   {ԗpR\[K[
+//! @brief   本番用コンソールロガー
 //-------------------------------------------------------------
 struct ConsoleLogger : public ILogger {
 	//-------------------------------------------------------------
-	//! @brief   Oo͊֐
-	//! @param   msg  [in] ObZ[W
-	//! @details {ԊŎgp郍K[
+	//! @brief   ログ出力関数実装
+	//! @param   msg  [in] ログメッセージ
+	//! @details 本番環境で使用するロガー実装
 	//-------------------------------------------------------------
 	void log(const std::string& msg) override {
 		std::cout << "[ConsoleLogger] " << msg << std::endl;
@@ -40,13 +40,13 @@ struct ConsoleLogger : public ILogger {
 
 //-------------------------------------------------------------
 //! @class   MockLogger
-//! @brief   eXgpbNK[
+//! @brief   テスト用モックロガー
 //-------------------------------------------------------------
 struct MockLogger : public ILogger {
 	//-------------------------------------------------------------
-	//! @brief   Oo͊֐
-	//! @param   msg  [in] ObZ[W
-	//! @details eXgŎgp郂bNK[
+	//! @brief   ログ出力関数実装
+	//! @param   msg  [in] ログメッセージ
+	//! @details テスト環境で使用するモックロガー実装
 	//-------------------------------------------------------------
 	void log(const std::string& msg) override {
 		std::cout << "[MockLogger] captured message: " << msg << std::endl;
@@ -55,20 +55,20 @@ struct MockLogger : public ILogger {
 
 //-------------------------------------------------------------
 //! @class   Service
-//! @brief   K[ɈˑT[rX
+//! @brief   ロガーに依存するサービス
 //-------------------------------------------------------------
 struct Service {
 	//-------------------------------------------------------------
-	//! @brief   RXgN^iILogger Ɉˑj
-	//! @param   logger  [in] K[CX^X
-	//! @details registerCtor gĈˑ֌Wtœo^
+	//! @brief   コンストラクタ（ILogger に依存）
+	//! @param   logger  [in] ロガーインスタンス
+	//! @details registerCtor を使って依存関係付きで登録
 	//-------------------------------------------------------------
 	explicit Service(std::shared_ptr<ILogger> logger) : logger_(std::move(logger)) {}
 
 	//-------------------------------------------------------------
-	//! @brief   T[rXs֐
-	//! @details ˑ郍K[găOo
-	//! @details run ֐ŃOo
+	//! @brief   サービス実行関数
+	//! @details 依存するロガーを使ってログ出力
+	//! @details run 関数内でログを出力
 	//-------------------------------------------------------------
 	void run() {
 		logger_->log("Service is running");
@@ -77,23 +77,23 @@ private:
 	std::shared_ptr<ILogger> logger_;
 };
 
-// Gg|Cg
+// エントリポイント
 int main() {
-	// Rei
+	// コンテナ生成
 	TsukinoDIContainer::Container container;
 
-	// 1. {ԗp ConsoleLogger o^
+	// 1. 本番用 ConsoleLogger を登録
 	container.registerType<ILogger, ConsoleLogger>(TsukinoDIContainer::Lifecycle::Singleton);
 	container.registerCtor<Service, Service, ILogger>(TsukinoDIContainer::Lifecycle::Transient);
 
 	auto service1 = container.resolve<Service>();
-	service1->run(); // ConsoleLogger g
+	service1->run(); // ConsoleLogger が使われる
 
-	// 2. eXgp MockLogger ɍւ
+	// 2. テスト用 MockLogger に差し替え
 	container.replaceType<ILogger, MockLogger>(TsukinoDIContainer::Lifecycle::Singleton);
-	// Service ̓o^͂̂܂܍ėp\
+	// Service の登録はそのまま再利用できる
 	auto service2 = container.resolve<Service>();
-	service2->run(); // MockLogger g
-	// vȌI
+	service2->run(); // MockLogger が使われる
+	// プログラムの終了
 	return 0;
 }
@@ -0,0 +1,130 @@
+//-------------------------------------------------------------
+//! @file   example9_async.cpp
+//! @brief  TsukinoDIContainer 非同期ファクトリ / resolveAsync 使用例（C++20）
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <TsukinoDIContainer/TsukinoDIContainer.hpp>
+
+using TsukinoDIContainer::Task;
+
+//-------------------------------------------------------------
+//! @class   IIndex
+//! @brief   検索インデックスインターフェース（初期化に I/O が必要）
+//-------------------------------------------------------------
+struct IIndex {
+	virtual std::string name() const = 0;
+	virtual ~IIndex() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   IConfig
+//! @brief   設定インターフェース（初期化に I/O が必要）
+//-------------------------------------------------------------
+struct IConfig {
+	virtual std::string value() const = 0;
+	virtual ~IConfig() = default;
+};
+
+//-------------------------------------------------------------
+//! @class   FileIndex / FileConfig
+//! @brief   ファイルから読み込む想定の実装
+//-------------------------------------------------------------
+struct FileIndex : public IIndex {
+	std::string name() const override { return "FileIndex"; }
+};
+struct FileConfig : public IConfig {
+	std::string value() const override { return "config.ini"; }
+};
+
+//-------------------------------------------------------------
+//! @class   SearchService
+//! @brief   インデックスと設定に依存するサービス（同期コンストラクタ）
+//-------------------------------------------------------------
+struct SearchService {
+	SearchService(std::shared_ptr<IIndex> index, std::shared_ptr<IConfig> config)
+		: index_(std::move(index)), config_(std::move(config)) {}
+	void run() { std::cout << "SearchService uses " << index_->name() << " / " << config_->value() << std::endl; }
+private:
+	std::shared_ptr<IIndex> index_;		// 依存するインデックス
+	std::shared_ptr<IConfig> config_;	// 依存する設定
+};
+
+static std::atomic<int> g_indexLoads{ 0 };	// インデックス読み込み回数
+
+//-------------------------------------------------------------
+//! @brief   インデックスの非同期読み込み（I/O を sleep で模擬）
+//-------------------------------------------------------------
+Task<std::shared_ptr<IIndex>> loadIndex() {
+	++g_indexLoads;
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	co_return std::make_shared<FileIndex>();
+}
+
+//-------------------------------------------------------------
+//! @brief   設定の非同期読み込み（I/O を sleep で模擬）
+//-------------------------------------------------------------
+Task<std::shared_ptr<IConfig>> loadConfig() {
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	co_return std::make_shared<FileConfig>();
+}
+
+//-------------------------------------------------------------
+//! @brief   複数のコルーチンから同時に同じ Singleton を待つ
+//-------------------------------------------------------------
+Task<int> resolveMany(TsukinoDIContainer::Container& container) {
+	std::vector<Task<std::shared_ptr<IIndex>>> tasks;
+	for (int i = 0; i < 8; ++i) {
+		tasks.push_back(container.resolveAsync<IIndex>());
+	}
+	auto indexes = co_await TsukinoDIContainer::whenAll(std::move(tasks), nullptr);
+	co_return static_cast<int>(indexes.size());
+}
+
+// エントリポイント
+int main() {
+	// スレッドプールとコンテナ生成
+	TsukinoDIContainer::ThreadPoolExecutor executor(4);
+	TsukinoDIContainer::Container container;
+	container.setAsyncExecutor(&executor);
+
+	// 1) I/O が必要な型を非同期ファクトリで登録（Singleton で共有）
+	container.registerAsyncFactory<IIndex>([]() { return loadIndex(); }, TsukinoDIContainer::Lifecycle::Singleton);
+	container.registerAsyncFactory<IConfig>([]() { return loadConfig(); }, TsukinoDIContainer::Lifecycle::Singleton);
+
+	// 2) 同期コンストラクタの型も依存付きで登録できる
+	container.registerCtor<SearchService, SearchService, IIndex, IConfig>(TsukinoDIContainer::Lifecycle::Transient);
+
+	// 3) 独立した 2 つの依存は並行に待たれる（約 200ms で完了）
+	const auto start = std::chrono::steady_clock::now();
+	auto service = TsukinoDIContainer::syncWait(container.resolveAsync<SearchService>());
+	const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+	service->run();
+	std::cout << "Resolved in " << (elapsed.count() < 350 ? "parallel" : "serial") << std::endl;
+
+	// 4) 初期化済み Singleton は同期 resolve からも取得できる
+	std::cout << "Sync resolve: " << container.resolve<IIndex>()->name() << std::endl;
+
+	// 5) 同時に待つ全員で初期化を共有（読み込みは 1 回だけ）
+	TsukinoDIContainer::Container other;
+	other.setAsyncExecutor(&executor);
+	other.registerAsyncFactory<IIndex>([]() { return loadIndex(); }, TsukinoDIContainer::Lifecycle::Singleton);
+	g_indexLoads = 0;
+	const int waiters = TsukinoDIContainer::syncWait(resolveMany(other));
+	std::cout << waiters << " awaiters, index loaded " << g_indexLoads << " time(s)" << std::endl;
+
+	// 6) 非同期ファクトリの型を初期化前に同期 resolve すると例外
+	try {
+		TsukinoDIContainer::Container lazy;
+		lazy.registerAsyncFactory<IConfig>([]() { return loadConfig(); });
+		lazy.resolve<IConfig>();
+	}
+	catch (const TsukinoDIContainer::ResolveException& ex) {
+		std::cerr << "[Error] " << ex.what() << std::endl;
+	}
+	// プログラムの終了
+	return 0;
+}
@@ -0,0 +1,487 @@
+//-------------------------------------------------------------
+//! @file   AsyncTask.hpp
+//! @brief  依存性注入コンテナライブラリの非同期タスク定義（C++20 コルーチン）
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+// コルーチンが利用可能な場合のみ非同期解決 API を有効にする
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define TSUKINO_DI_HAS_COROUTINES 1
+#endif
+#endif
+#ifndef TSUKINO_DI_HAS_COROUTINES
+#define TSUKINO_DI_HAS_COROUTINES 0
+#endif
+
+#include "ThreadPoolExecutor.hpp"	// ThreadPoolExecutor クラス
+
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	// コルーチンの有無でクラス定義が変わらないよう、宣言のみ常に公開する（定義はコルーチン有効時のみ）
+	template<typename T>
+	class Task;
+}
+
+#if TSUKINO_DI_HAS_COROUTINES
+#include <coroutine>          // std::coroutine_handle
+#include <exception>          // std::exception_ptr
+#include <optional>           // std::optional
+#include <atomic>             // std::atomic
+#include <memory>             // std::shared_ptr
+#include <mutex>              // std::mutex
+#include <condition_variable> // std::condition_variable
+#include <utility>            // std::move
+#include <vector>             // std::vector
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @class   Task
+	//! @brief   遅延開始型のコルーチンタスク
+	//! @tparam  T  結果型
+	//! @details co_await された時点で開始し、完了時に待機側を再開する。
+	//-------------------------------------------------------------
+	template<typename T>
+	class Task {
+	public:
+		//---------------------------------------------------------
+		//! @struct  promise_type
+		//! @brief   コルーチンのプロミス
+		//---------------------------------------------------------
+		struct promise_type {
+			std::optional<T> value_;					// 結果
+			std::exception_ptr error_;					// 発生した例外
+			std::coroutine_handle<> continuation_;		// 完了時に再開する待機側
+
+			//! @brief 最終サスペンド時に待機側へ制御を移すアウェイタ
+			struct FinalAwaiter {
+				bool await_ready() noexcept { return false; }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+					auto next = h.promise().continuation_;
+					return next ? next : std::noop_coroutine();
+				}
+				void await_resume() noexcept {}
+			};
+
+			Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			FinalAwaiter final_suspend() noexcept { return {}; }
+			void return_value(T value) { value_ = std::move(value); }
+			void unhandled_exception() { error_ = std::current_exception(); }
+		};
+
+		//---------------------------------------------------------
+		// コンストラクタ
+		//! @param  handle  [in] コルーチンハンドル
+		//---------------------------------------------------------
+		explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+		//---------------------------------------------------------
+		// ムーブコンストラクタ
+		//---------------------------------------------------------
+		Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+		//---------------------------------------------------------
+		// ムーブ代入
+		//---------------------------------------------------------
+		Task& operator=(Task&& other) noexcept {
+			if (this != &other) {
+				if (handle_) handle_.destroy();
+				handle_ = std::exchange(other.handle_, nullptr);
+			}
+			return *this;
+		}
+
+		//---------------------------------------------------------
+		// コピー禁止
+		//---------------------------------------------------------
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+
+		//---------------------------------------------------------
+		// デストラクタ
+		//---------------------------------------------------------
+		~Task() {
+			if (handle_) handle_.destroy();
+		}
+
+		//---------------------------------------------------------
+		// co_await 用アウェイタ
+		//---------------------------------------------------------
+		auto operator co_await() && noexcept {
+			struct Awaiter {
+				std::coroutine_handle<promise_type> handle_;
+				bool await_ready() noexcept { return !handle_ || handle_.done(); }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> waiting) noexcept {
+					handle_.promise().continuation_ = waiting;
+					return handle_;	// 対称転送でタスクを開始
+				}
+				T await_resume() {
+					auto& promise = handle_.promise();
+					if (promise.error_) {
+						std::rethrow_exception(promise.error_);
+					}
+					return std::move(*promise.value_);
+				}
+			};
+			return Awaiter{ handle_ };
+		}
+
+	private:
+		std::coroutine_handle<promise_type> handle_;	// 所有するコルーチン
+	};
+
+	//-------------------------------------------------------------
+	//! @class   Task<void>
+	//! @brief   結果を持たないコルーチンタスク
+	//-------------------------------------------------------------
+	template<>
+	class Task<void> {
+	public:
+		struct promise_type {
+			std::exception_ptr error_;
+			std::coroutine_handle<> continuation_;
+
+			struct FinalAwaiter {
+				bool await_ready() noexcept { return false; }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+					auto next = h.promise().continuation_;
+					return next ? next : std::noop_coroutine();
+				}
+				void await_resume() noexcept {}
+			};
+
+			Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+			std::suspend_always initial_suspend() noexcept { return {}; }
+			FinalAwaiter final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() { error_ = std::current_exception(); }
+		};
+
+		explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+		Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+		Task& operator=(Task&& other) noexcept {
+			if (this != &other) {
+				if (handle_) handle_.destroy();
+				handle_ = std::exchange(other.handle_, nullptr);
+			}
+			return *this;
+		}
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+		~Task() {
+			if (handle_) handle_.destroy();
+		}
+
+		auto operator co_await() && noexcept {
+			struct Awaiter {
+				std::coroutine_handle<promise_type> handle_;
+				bool await_ready() noexcept { return !handle_ || handle_.done(); }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> waiting) noexcept {
+					handle_.promise().continuation_ = waiting;
+					return handle_;
+				}
+				void await_resume() {
+					if (handle_.promise().error_) {
+						std::rethrow_exception(handle_.promise().error_);
+					}
+				}
+			};
+			return Awaiter{ handle_ };
+		}
+
+	private:
+		std::coroutine_handle<promise_type> handle_;
+	};
+
+	//-------------------------------------------------------------
+	// スレッドプールへ実行を移すアウェイタを取得
+	//! @param  executor  [in] 移動先のスレッドプール
+	//! @return co_await するとプールのワーカースレッドで再開する
+	//-------------------------------------------------------------
+	inline auto scheduleOn(ThreadPoolExecutor& executor) {
+		struct Awaiter {
+			ThreadPoolExecutor& executor_;
+			bool await_ready() noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> h) {
+				executor_.post([h]() { h.resume(); });
+			}
+			void await_resume() noexcept {}
+		};
+		return Awaiter{ executor };
+	}
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  DetachedTask
+		//! @brief   即時開始・自己破棄するコルーチン（内部用）
+		//---------------------------------------------------------
+		struct DetachedTask {
+			struct promise_type {
+				DetachedTask get_return_object() noexcept { return {}; }
+				std::suspend_never initial_suspend() noexcept { return {}; }
+				std::suspend_never final_suspend() noexcept { return {}; }
+				void return_void() noexcept {}
+				void unhandled_exception() noexcept { std::terminate(); }
+			};
+		};
+
+		//---------------------------------------------------------
+		// タスクを切り離して実行し、完了時にコールバックを呼ぶ
+		//! @param  executor  [in] 実行先（nullptr なら呼び出しスレッドで開始）
+		//! @param  task      [in] 実行するタスク
+		//! @param  onDone    [in] 完了時コールバック（結果, 例外）
+		//---------------------------------------------------------
+		template<typename T, typename TCallback>
+		DetachedTask runDetached(ThreadPoolExecutor* executor, Task<T> task, TCallback onDone) {
+			if (executor) {
+				co_await scheduleOn(*executor);
+			}
+			std::optional<T> value;
+			std::exception_ptr error;
+			try {
+				value = co_await std::move(task);
+			}
+			catch (...) {
+				error = std::current_exception();
+			}
+			onDone(std::move(value), error);
+		}
+
+		//---------------------------------------------------------
+		//! @struct  WhenAllState
+		//! @brief   whenAll の共有状態（内部用）
+		//---------------------------------------------------------
+		template<typename T>
+		struct WhenAllState {
+			std::vector<Task<T>> tasks_;				// 待機対象
+			std::vector<std::optional<T>> results_;		// 結果（タスクと同順）
+			std::exception_ptr error_;					// 最初に発生した例外
+			std::mutex errorMutex_;						// error_ 保護用
+			std::atomic<std::size_t> remaining_{ 0 };	// 未完了数（待機側の 1 を含む）
+			std::coroutine_handle<> continuation_;		// 全完了時に再開する待機側
+			ThreadPoolExecutor* executor_ = nullptr;	// 実行先
+		};
+	}
+
+	//-------------------------------------------------------------
+	// 複数タスクを並行に実行し、全ての完了を待つ
+	//! @tparam T         結果型
+	//! @param  tasks     [in] 待機するタスク群
+	//! @param  executor  [in] 実行先（nullptr の場合は順に実行）
+	//! @return タスクと同順の結果
+	//! @throws 最初に失敗したタスクの例外（全タスクの完了後に再送出）
+	//-------------------------------------------------------------
+	template<typename T>
+	Task<std::vector<T>> whenAll(std::vector<Task<T>> tasks, ThreadPoolExecutor* executor) {
+		std::vector<T> results;
+		results.reserve(tasks.size());
+		// 実行先が無い、またはタスクが 1 つなら順に待つだけでよい
+		if (!executor || tasks.size() <= 1) {
+			for (auto& task : tasks) {
+				results.push_back(co_await std::move(task));
+			}
+			co_return results;
+		}
+
+		auto state = std::make_shared<detail::WhenAllState<T>>();
+		state->tasks_ = std::move(tasks);
+		state->results_.resize(state->tasks_.size());
+		state->executor_ = executor;
+
+		//! @brief 全タスクを起動し、最後の完了で待機側を再開するアウェイタ
+		struct Awaiter {
+			std::shared_ptr<detail::WhenAllState<T>> state_;
+			bool await_ready() noexcept { return false; }
+			bool await_suspend(std::coroutine_handle<> h) {
+				// 起動後はフレームが破棄され得るため、ローカルにコピーして扱う
+				auto st = state_;
+				const std::size_t count = st->tasks_.size();
+				st->continuation_ = h;
+				st->remaining_.store(count + 1, std::memory_order_relaxed);
+				for (std::size_t i = 0; i < count; ++i) {
+					detail::runDetached(st->executor_, std::move(st->tasks_[i]),
+						[st, i](std::optional<T> value, std::exception_ptr error) {
+							if (error) {
+								std::lock_guard<std::mutex> lock(st->errorMutex_);
+								if (!st->error_) st->error_ = error;
+							}
+							else {
+								st->results_[i] = std::move(value);
+							}
+							if (st->remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+								st->continuation_.resume();
+							}
+						});
+				}
+				// 待機側の分を減らし、既に全完了していればサスペンドしない
+				return st->remaining_.fetch_sub(1, std::memory_order_acq_rel) != 1;
+			}
+			void await_resume() noexcept {}
+		};
+		Awaiter awaiter{ state };
+		co_await awaiter;
+
+		if (state->error_) {
+			std::rethrow_exception(state->error_);
+		}
+		for (auto& r : state->results_) {
+			results.push_back(std::move(*r));
+		}
+		co_return results;
+	}
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  SyncWaitState
+		//! @brief   syncWait の待機状態（内部用）
+		//---------------------------------------------------------
+		template<typename T>
+		struct SyncWaitState {
+			std::mutex mutex_;
+			std::condition_variable cv_;
+			bool done_ = false;
+			std::optional<T> value_;
+			std::exception_ptr error_;
+		};
+	}
+
+	//-------------------------------------------------------------
+	// タスクの完了を呼び出しスレッドでブロックして待つ
+	//! @tparam T     結果型
+	//! @param  task  [in] 実行するタスク
+	//! @return タスクの結果
+	//! @details コルーチン外（main 等）から非同期解決を利用するための補助
+	//-------------------------------------------------------------
+	template<typename T>
+	T syncWait(Task<T> task) {
+		detail::SyncWaitState<T> state;
+		detail::runDetached(nullptr, std::move(task),
+			[&state](std::optional<T> value, std::exception_ptr error) {
+				std::lock_guard<std::mutex> lock(state.mutex_);
+				state.value_ = std::move(value);
+				state.error_ = error;
+				state.done_ = true;
+				state.cv_.notify_all();
+			});
+		std::unique_lock<std::mutex> lock(state.mutex_);
+		state.cv_.wait(lock, [&state]() { return state.done_; });
+		if (state.error_) {
+			std::rethrow_exception(state.error_);
+		}
+		return std::move(*state.value_);
+	}
+
+	//-------------------------------------------------------------
+	//! @class   AsyncSharedInit
+	//! @brief   非同期初期化を全待機者で共有する状態
+	//! @details 最初の待機者のみ初期化タスクを起動し、他の待機者は完了を待つ。
+	//!          失敗時は待機中の全員に例外を返し、次回の待機で再試行する。
+	//-------------------------------------------------------------
+	class AsyncSharedInit {
+		//! @brief 待機中のコルーチンと結果の受け渡し先
+		struct Waiter {
+			std::coroutine_handle<> handle_;	// 再開するコルーチン
+			std::shared_ptr<void> value_;		// 初期化結果
+			std::exception_ptr error_;			// 発生した例外
+		};
+
+	public:
+		//---------------------------------------------------------
+		// 初期化の完了を待つ
+		//! @param  start     [in] 初期化タスクを生成する関数（最初の待機者のみ呼ぶ）
+		//! @param  executor  [in] 初期化タスクと待機者再開の実行先
+		//! @return 初期化結果
+		//---------------------------------------------------------
+		template<typename TStart>
+		Task<std::shared_ptr<void>> await(TStart start, ThreadPoolExecutor* executor) {
+			//! @brief 待機者を登録し、必要なら初期化を起動するアウェイタ
+			struct Awaiter {
+				AsyncSharedInit* self_;
+				TStart* start_;
+				ThreadPoolExecutor* executor_;
+				Waiter waiter_;
+
+				bool await_ready() {
+					std::lock_guard<std::mutex> lock(self_->mutex_);
+					waiter_.value_ = self_->value_;
+					return waiter_.value_ != nullptr;
+				}
+				bool await_suspend(std::coroutine_handle<> h) {
+					AsyncSharedInit* self = self_;
+					ThreadPoolExecutor* executor = executor_;
+					bool launch = false;
+					{
+						std::lock_guard<std::mutex> lock(self->mutex_);
+						if (self->value_) {
+							waiter_.value_ = self->value_;
+							return false;
+						}
+						waiter_.handle_ = h;
+						self->waiters_.push_back(&waiter_);
+						if (!self->running_) {
+							self->running_ = true;
+							launch = true;
+						}
+					}
+					if (launch) {
+						// 初期化完了までは再開されないため、ここまではフレームが有効
+						auto task = (*start_)();
+						// 以降 this は再開済みで破棄されている可能性があるためローカル変数のみ使う
+						detail::runDetached(executor, std::move(task),
+							[self, executor](std::optional<std::shared_ptr<void>> value, std::exception_ptr error) {
+								self->complete(value ? std::move(*value) : nullptr, error, executor);
+							});
+					}
+					return true;
+				}
+				std::shared_ptr<void> await_resume() {
+					if (waiter_.error_) {
+						std::rethrow_exception(waiter_.error_);
+					}
+					return waiter_.value_;
+				}
+			};
+			Awaiter awaiter{ this, &start, executor, {} };
+			co_return co_await awaiter;
+		}
+
+	private:
+		//---------------------------------------------------------
+		// 初期化完了を全待機者へ通知
+		//! @param  value     [in] 初期化結果
+		//! @param  error     [in] 発生した例外
+		//! @param  executor  [in] 待機者再開の実行先（nullptr なら順に再開）
+		//---------------------------------------------------------
+		void complete(std::shared_ptr<void> value, std::exception_ptr error, ThreadPoolExecutor* executor) {
+			std::vector<Waiter*> waiters;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				running_ = false;
+				if (!error) {
+					value_ = value;
+				}
+				waiters.swap(waiters_);
+			}
+			for (std::size_t i = 0; i < waiters.size(); ++i) {
+				Waiter* w = waiters[i];
+				w->value_ = value;
+				w->error_ = error;
+				// 最後の 1 件以外はプールへ回し、待機者同士を並行に再開する
+				if (executor && i + 1 < waiters.size()) {
+					auto h = w->handle_;
+					executor->post([h]() { h.resume(); });
+				}
+				else {
+					w->handle_.resume();
+				}
+			}
+		}
+
+		std::mutex mutex_;					// 状態保護用
+		bool running_ = false;				// 初期化実行中フラグ
+		std::shared_ptr<void> value_;		// 初期化結果（成功時）
+		std::vector<Waiter*> waiters_;		// 待機中のコルーチン
+	};
+}// namespace TsukinoDIContainer
+#endif // TSUKINO_DI_HAS_COROUTINES
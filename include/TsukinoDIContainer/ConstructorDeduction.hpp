@@ -0,0 +1,252 @@
+//-------------------------------------------------------------
+//! @file   ConstructorDeduction.hpp
+//! @brief  依存性注入コンテナライブラリのコンストラクタ引数推論定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint32_t
+#include <initializer_list> // std::initializer_list
+#include <memory>       // std::shared_ptr
+#include <new>          // placement new
+#include <type_traits>  // std::is_constructible
+#include "TypeId.hpp"   // TypeId
+#include <utility>      // std::index_sequence
+#include <vector>       // std::vector
+#include "Lazy.hpp"     // Lazy<T>
+#include "Generic.hpp"  // detail::noteGenerics
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  推論するコンストラクタ引数の最大数
+		//---------------------------------------------------------
+		constexpr std::size_t kMaxDeducedArity = 10;
+
+		//---------------------------------------------------------
+		//! @struct  CtorArgKey
+		//! @brief   (具象型, 引数位置) ごとの引数型の記録先
+		//! @details 戻り値型を推論する friend 関数を宣言のみ行い、
+		//!          CtorArgRecord の実体化で定義することで引数型をコンパイル時に取り出す
+		//---------------------------------------------------------
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wnon-template-friend"
+#endif
+		template<typename TImplementation, std::size_t N>
+		struct CtorArgKey {
+			friend constexpr auto ctorArgType(CtorArgKey);
+		};
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+		//---------------------------------------------------------
+		//! @struct  CtorArgRecord
+		//! @brief   引数型を記録（実体化時に ctorArgType を定義）
+		//---------------------------------------------------------
+		template<typename TImplementation, std::size_t N, typename TArg>
+		struct CtorArgRecord {
+			friend constexpr auto ctorArgType(CtorArgKey<TImplementation, N>) { return static_cast<TArg*>(nullptr); }
+		};
+
+		//---------------------------------------------------------
+		//! @struct  CtorAnyProbe
+		//! @brief   任意の引数型へ変換できる探査用の型（記録しない、未評価文脈でのみ使用）
+		//! @details 引数の数の探査に使う。同じ数の引数のコンストラクタが複数あると曖昧となり構築できない。
+		//!          自身の型への変換（コピー・ムーブ）は除外する。
+		//---------------------------------------------------------
+		template<typename TImplementation>
+		struct CtorAnyProbe {
+			template<typename U,
+				typename = std::enable_if_t<!std::is_same<std::remove_cv_t<U>, TImplementation>::value>>
+			operator U&() const noexcept;
+		};
+		template<typename TImplementation, std::size_t N>
+		using CtorAnyProbeAt = CtorAnyProbe<TImplementation>;	// 位置 N の記録しない探査型
+
+		//---------------------------------------------------------
+		//! @struct  CtorArgProbe
+		//! @brief   任意の引数型へ変換できる探査用の型（未評価文脈でのみ使用）
+		//! @details 変換先の型を CtorArgRecord に記録する。自身の型への変換（コピー・ムーブ）は除外する。
+		//!          同じ位置の記録は 1 つしか定義できないため、一意に構築できる引数の数でのみ使う。
+		//---------------------------------------------------------
+		template<typename TImplementation, std::size_t N>
+		struct CtorArgProbe {
+			template<typename U,
+				typename = std::enable_if_t<!std::is_same<std::remove_cv_t<U>, TImplementation>::value>,
+				std::size_t = sizeof(CtorArgRecord<TImplementation, N, std::remove_cv_t<U>>)>
+			operator U&() const noexcept;
+		};
+
+		//---------------------------------------------------------
+		//! @brief  探査用の型を N 個渡して構築できるか（記録しない）
+		//---------------------------------------------------------
+		template<typename TImplementation, typename TSequence>
+		struct IsProbeConstructible;
+		template<typename TImplementation, std::size_t... I>
+		struct IsProbeConstructible<TImplementation, std::index_sequence<I...>>
+			: std::is_constructible<TImplementation, CtorAnyProbeAt<TImplementation, I>...> {};
+
+		//---------------------------------------------------------
+		//! @brief  記録用の探査型を N 個渡して構築できるか（実体化で引数型を記録する）
+		//---------------------------------------------------------
+		template<typename TImplementation, typename TSequence>
+		struct IsRecordConstructible;
+		template<typename TImplementation, std::size_t... I>
+		struct IsRecordConstructible<TImplementation, std::index_sequence<I...>>
+			: std::is_constructible<TImplementation, CtorArgProbe<TImplementation, I>...> {};
+
+		//---------------------------------------------------------
+		//! @brief  コンストラクタの引数の数（N から減らして最初に一意に構築できた数、最も引数の多いもの）
+		//! @details 同じ数の引数のコンストラクタが複数ある数は曖昧なため選ばない
+		//---------------------------------------------------------
+		template<typename TImplementation, std::size_t N>
+		struct CtorArity : std::conditional_t<
+			IsProbeConstructible<TImplementation, std::make_index_sequence<N>>::value,
+			std::integral_constant<std::size_t, N>,
+			CtorArity<TImplementation, N - 1>> {};
+		template<typename TImplementation>
+		struct CtorArity<TImplementation, 0> : std::integral_constant<std::size_t, 0> {};
+
+		//---------------------------------------------------------
+		//! @brief  N 番目の引数型（参照・cv 修飾を除いた型）
+		//---------------------------------------------------------
+		template<typename TImplementation, std::size_t N>
+		using CtorArgAt = std::remove_pointer_t<decltype(ctorArgType(CtorArgKey<TImplementation, N>{}))>;
+
+		//---------------------------------------------------------
+		//! @struct  CtorArgTraits
+		//! @brief   引数型ごとの依存型と渡し方（X / X& / const X& はインスタンスへの参照）
+		//! @details 値渡しと参照は探査で区別できないため、どちらも参照として扱う
+		//---------------------------------------------------------
+		template<typename TArg>
+		struct CtorArgTraits {
+			using Dependency = TArg;				// 解決する型
+			static constexpr bool kLazy = false;	// 遅延解決か
+			static constexpr bool kReference = true;	// インスタンスへの参照を渡すか（構築後に参照が残る）
+			static TArg& get(const std::shared_ptr<void>& arg) { return *static_cast<TArg*>(arg.get()); }
+		};
+		template<typename T>
+		struct CtorArgTraits<std::shared_ptr<T>> {
+			using Dependency = std::remove_cv_t<T>;
+			static constexpr bool kLazy = false;
+			static constexpr bool kReference = false;
+			static std::shared_ptr<T> get(const std::shared_ptr<void>& arg) { return std::static_pointer_cast<T>(arg); }
+		};
+		template<typename T>
+		struct CtorArgTraits<Lazy<T>> {
+			using Dependency = std::remove_cv_t<T>;
+			static constexpr bool kLazy = true;
+			static constexpr bool kReference = false;
+		};
+
+		//---------------------------------------------------------
+		//! @struct  AutoCtor
+		//! @brief   推論したコンストラクタで具象型を構築する
+		//! @tparam  TInterface       抽象型インターフェース
+		//! @tparam  TImplementation  具象型実装
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation>
+		struct AutoCtor {
+			static constexpr std::size_t kArity = CtorArity<TImplementation, kMaxDeducedArity>::value;	// 引数の数
+			using Sequence = std::make_index_sequence<kArity>;
+
+			static_assert(kArity > 0 || std::is_default_constructible<TImplementation>::value,
+				"TImplementation has no unique constructor deducible from shared_ptr<X> / Lazy<X> / X& parameters "
+				"(constructors with the same number of parameters are ambiguous); use registerCtor");
+			// 一意に構築できる数でのみ引数型を記録（以降の Traits はこの記録を参照する）
+			static_assert(kArity == 0 || IsRecordConstructible<TImplementation, Sequence>::value,
+				"TImplementation constructor parameters could not be deduced; use registerCtor");
+
+			//! @brief N 番目の引数の特性
+			template<std::size_t N>
+			using Traits = CtorArgTraits<CtorArgAt<TImplementation, N>>;
+
+			//! @brief 遅延解決の引数を含むか
+			template<std::size_t... I>
+			static constexpr bool hasLazyImpl(std::index_sequence<I...>) { return (false || ... || Traits<I>::kLazy); }
+			static constexpr bool hasLazy() { return hasLazyImpl(Sequence{}); }
+
+			//! @brief N 番目の引数に対応する依存インスタンスの添字（遅延解決の引数は数えない）
+			template<std::size_t... I>
+			static constexpr std::size_t argIndexImpl(std::index_sequence<I...>) { return (std::size_t{ 0 } + ... + (Traits<I>::kLazy ? 0 : 1)); }
+			template<std::size_t N>
+			static constexpr std::size_t argIndex() { return argIndexImpl(std::make_index_sequence<N>{}); }
+
+			//! @brief 参照で受け取る依存（依存型リストの位置のビット）
+			template<std::size_t... I>
+			static constexpr std::uint32_t refMaskImpl(std::index_sequence<I...>) {
+				return (std::uint32_t{ 0 } | ... | (Traits<I>::kReference ? std::uint32_t{ 1 } << argIndex<I>() : std::uint32_t{ 0 }));
+			}
+			static constexpr std::uint32_t refMask() { return refMaskImpl(Sequence{}); }
+
+			//! @brief 依存型リスト（遅延解決の引数は含まない）
+			template<std::size_t... I>
+			static std::vector<TypeId> depsImpl(std::index_sequence<I...>) {
+				std::vector<TypeId> deps;
+				deps.reserve(kArity);
+				(void)std::initializer_list<int>{ (Traits<I>::kLazy ? 0 : (deps.emplace_back(typeId<typename Traits<I>::Dependency>()), 0))... };
+				return deps;
+			}
+			static std::vector<TypeId> deps() { return depsImpl(Sequence{}); }
+
+			//! @brief オープンジェネリック登録の対象となる依存型を記録（遅延解決の引数も含む）
+			template<std::size_t... I>
+			static void noteGenericsImpl(Container& container, std::index_sequence<I...>) {
+				detail::noteGenerics<typename Traits<I>::Dependency...>(container);
+			}
+			static void noteGenerics(Container& container) { noteGenericsImpl(container, Sequence{}); }
+			template<std::size_t... I>
+			static constexpr NoteGenericsFn noteGenericsFnImpl(std::index_sequence<I...>) { return detail::noteGenericsFn<typename Traits<I>::Dependency...>(); }
+			static constexpr NoteGenericsFn noteGenericsFn() { return noteGenericsFnImpl(Sequence{}); }
+
+			//! @brief N 番目の引数を作成
+			template<std::size_t N, typename TResolver>
+			static decltype(auto) arg(const std::vector<std::shared_ptr<void>>& args, const TResolver& resolver) {
+				if constexpr (Traits<N>::kLazy) {
+					using Dependency = typename Traits<N>::Dependency;
+					return Lazy<Dependency>([resolver]() { return resolver(typeId<Dependency>()); });
+				}
+				else {
+					return Traits<N>::get(args[argIndex<N>()]);
+				}
+			}
+
+			//! @brief 構築（依存インスタンスは depsImpl の順）
+			template<typename TResolver, std::size_t... I>
+			static std::shared_ptr<void> createImpl(const std::vector<std::shared_ptr<void>>& args, const TResolver& resolver, std::index_sequence<I...>) {
+				(void)args;
+				(void)resolver;
+				std::shared_ptr<TInterface> created = std::make_shared<TImplementation>(arg<I>(args, resolver)...);
+				return created;
+			}
+			template<typename TResolver>
+			static std::shared_ptr<void> create(const std::vector<std::shared_ptr<void>>& args, const TResolver& resolver) {
+				return createImpl(args, resolver, Sequence{});
+			}
+
+			//! @brief 関数ポインタとして使う構築（遅延解決の引数がない場合のみ）
+			static std::shared_ptr<void> createStatic(const std::vector<std::shared_ptr<void>>& args) {
+				static_assert(!hasLazy(), "Lazy<T> parameters need a container; use Container::registerType");
+				return create(args, [](const TypeId&) { return std::shared_ptr<void>(); });
+			}
+
+			//! @brief 指定位置への構築（args が nullptr なら破棄、遅延解決の引数がない場合のみ）
+			template<std::size_t... I>
+			static void* placeImpl(void* where, const std::vector<std::shared_ptr<void>>& args, std::index_sequence<I...>) {
+				(void)args;
+				TInterface* created = ::new (where) TImplementation(Traits<I>::get(args[I])...);
+				return created;
+			}
+			static void* placeStatic(void* where, const std::vector<std::shared_ptr<void>>* args) {
+				static_assert(!hasLazy(), "Lazy<T> parameters need a container; use Container::registerType");
+				if (!args) {
+					static_cast<TImplementation*>(where)->~TImplementation();
+					return nullptr;
+				}
+				return placeImpl(where, *args, Sequence{});
+			}
+		};
+	}
+}// namespace TsukinoDIContainer
@@ -1,348 +1,1619 @@
 //-------------------------------------------------------------
 //! @file   Container.hpp
-//! @brief  ˑReiCũRei`
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリのコンテナ定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
 #include <memory>        // std::shared_ptr
 #include <unordered_map> // std::unordered_map
 #include <vector>        // std::vector
 #include <functional>    // std::function
-#include <typeindex>     // std::type_index
+#include "TypeId.hpp"    // TypeId
 #include <shared_mutex>  // std::shared_mutex
-#include "ResolveException.hpp" // ƎO
-#include "ScopedContext.hpp"    // ScopedContext NX
-#include "Lifecycle.hpp"        // CtTCN enum
-// O : TsukinoDIContainer
+#include <mutex>         // std::unique_lock
+#include <array>         // std::array
+#include <atomic>        // std::atomic
+#include <cstdint>       // std::uint64_t
+#include <algorithm>     // std::find
+#include <string>        // std::string
+#include <chrono>        // std::chrono::steady_clock
+#include "ResolveException.hpp" // 独自例外
+#include "ResolveResult.hpp"    // 例外を投げない解決結果
+#include "ScopedContext.hpp"    // ScopedContext クラス
+#include "Lifecycle.hpp"        // ライフサイクル enum
+#include "AsyncTask.hpp"        // Task / ThreadPoolExecutor（非同期解決）
+#include "DependencyGraph.hpp"  // DependencyGraph クラス
+#include "ValidationReport.hpp" // ValidationReport 構造体
+#include "Decorator.hpp"        // 静的デコレータ合成
+#include "ObjectPool.hpp"       // Pooled ライフサイクル用プール
+#include "PerThreadSlot.hpp"    // PerThread ライフサイクル用スロット
+#include "InstanceCache.hpp"    // Cached ライフサイクル用キャッシュ
+#include "ReplicaSet.hpp"       // Replicated ライフサイクル用レプリカ
+#include "RegistrationBatch.hpp" // 一括登録
+#include "Module.hpp"            // モジュール
+#include "ContainerManifest.hpp" // 登録マニフェスト
+#include "ConstructorDeduction.hpp" // コンストラクタ引数推論
+#include "Lazy.hpp"              // 遅延解決ハンドル
+#include "LockProfile.hpp"       // ロック計測
+#include "InstanceAccounting.hpp" // インスタンス計上
+#include "ResolveTrace.hpp"      // 解決トレース
+#include "Generic.hpp"           // オープンジェネリック登録
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer {
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  ContextualKey
+		//! @brief   消費側ごとの依存の登録を TypeId で識別するためのタグ
+		//---------------------------------------------------------
+		template<typename TConsumer, typename TInterface>
+		struct ContextualKey {};
+	}
+
 	//-------------------------------------------------------------
 	//! @class   Container
-	//! @brief   ˑReiNX
-	//! @details ^o^AAXR[vǗ
+	//! @brief   依存性注入コンテナクラス
+	//! @details 型登録、解決、スコープ管理を提供
 	//-------------------------------------------------------------
-	class Container {
-		friend class ScopedContext; // ScopedContext ɓANZX
+	class Container : public std::enable_shared_from_this<Container> {
+		friend class ScopedContext; // ScopedContext に内部アクセスを許可
+		template<typename T>
+		friend void detail::noteGeneric(Container& container);	// オープンジェネリックの要求を記録
 	public:
 		//-------------------------------------------------------------
-		// ^o^
-		//! @tparam  TInterface			 ی^C^[tF[X
-		//! @tparam  TImplementation	 ی^
-		//! @param   cycle_  [in]        CtTCNǗ@iftHgTransientj
-		//! @throws	 ResolveException ɓo^ς݂̏ꍇ
-		//! @details o^ς݂̏ꍇ͗O𓊂B㏑ꍇReplacegpĂB
+		// コンストラクタ
+		//-------------------------------------------------------------
+		Container() = default;
+
+		//-------------------------------------------------------------
+		// デストラクタ
+		//! @details 解決キャッシュのエポックを進め、同一アドレスに再生成された
+		//!          コンテナが古いキャッシュを参照しないようにする
+		//-------------------------------------------------------------
+		~Container();
+
+		//-------------------------------------------------------------
+		// 型登録
+		//! @tparam  TInterface			 抽象型インターフェース
+		//! @tparam  TImplementation	 具象型実装
+		//! @param   cycle_  [in]        ライフサイクル管理方法（デフォルトはTransient）
+		//! @throws	 ResolveException 既に登録済みの場合
+		//! @details 登録済みの場合は例外を投げる。上書きしたい場合はReplaceを使用してください。
+		//!          依存はコンストラクタの引数からコンパイル時に推論する（引数が最も多い一意なコンストラクタ、最大 10 個）。
+		//!          - std::shared_ptr<X> : X を解決して渡す
+		//!          - Lazy<X>            : 初回参照時に解決するハンドルを渡す（依存グラフの辺にはならないため、検証済みでも解決時に循環を検出する）
+		//!          - X& / const X&      : 解決したインスタンスへの参照を渡す（X は Singleton に限る。それ以外は
+		//!                                 構築後に破棄されうるため、validate が報告し、未検証なら構築時に例外を投げる）
+		//!          同じ引数の数のコンストラクタが複数ある場合、その数は曖昧なため推論の対象にしない
+		//!          （他に候補がなければ static_assert で停止するため、registerCtor を使用してください）。
 		//-------------------------------------------------------------
 		template<typename TInterface, typename TImplementation>
 		void registerType(Lifecycle cycle_ = Lifecycle::Transient);
 
 		//-------------------------------------------------------------
-		// ^o^㏑
-		//! @tparam  TInterface			 ی^C^[tF[X
-		//! @tparam  TImplementation	 ی^
-		//! @param   cycle_  [in]        CtTCNǗ@iftHgTransientj
-		//! @details ɓo^ς݂̏ꍇł㏑Bo^̏ꍇ͐VKo^ƂȂB
+		// 型登録上書き
+		//! @tparam  TInterface			 抽象型インターフェース
+		//! @tparam  TImplementation	 具象型実装
+		//! @param   cycle_  [in]        ライフサイクル管理方法（デフォルトはTransient）
+		//! @details 既に登録済みの場合でも上書きする。未登録の場合は新規登録となる。
+		//!          依存の推論は registerType と同じ。
 		//-------------------------------------------------------------
 		template<typename TInterface, typename TImplementation>
 		void replaceType(Lifecycle cycle_ = Lifecycle::Transient);
 
 		//-------------------------------------------------------------
-		// RXgN^Ăяo⏕
-		//! @tparam TImplementation ی^
-		//! @tparam TDeps         ˑ^Xg
-		//! @param  args          [in] ˑCX^XXg
-		//! @param  I             CfbNXV[PX
-		//! @return ꂽCX^X
-		//! @details ˑCX^XÓI|C^LXgăRXgN^ɓn
+		// コンストラクタ呼び出し補助
+		//! @tparam TImplementation 具象型実装
+		//! @tparam TDeps         依存型リスト
+		//! @param  args          [in] 依存インスタンスリスト
+		//! @param  I             インデックスシーケンス
+		//! @return 生成されたインスタンス
+		//! @details 依存インスタンスを静的ポインタキャストしてコンストラクタに渡す
 		//-------------------------------------------------------------
 		template<typename TInterface, typename TImplementation, typename... TDeps>
 		void registerCtor(Lifecycle cycle);
 
 		//-------------------------------------------------------------
-		// RXgN^Ăяo⏕㏑
-		//! @tparam TImplementation ی^
-		//! @tparam TDeps         ˑ^Xg
-		//! @param  args          [in] ˑCX^XXg
-		//! @return ꂽCX^X
-		//! @details ɓo^ς݂̏ꍇł㏑Bo^̏ꍇ͐VKo^ƂȂB
+		// コンストラクタ呼び出し補助上書き
+		//! @tparam TImplementation 具象型実装
+		//! @tparam TDeps         依存型リスト
+		//! @param  args          [in] 依存インスタンスリスト
+		//! @return 生成されたインスタンス
+		//! @details 既に登録済みの場合でも上書きする。未登録の場合は新規登録となる。
 		//-------------------------------------------------------------
 		template<typename TInterface, typename TImplementation, typename... TDeps>
 		void replaceCtor(Lifecycle cycle_ = Lifecycle::Transient);
 
 		//-------------------------------------------------------------
-		// CX^Xo^
-		//! @tparam TInterface ی^C^[tF[X
-		//! @param  instance   [in] ی^CX^X
-		//! @throws	 ResolveException ɓo^ς݂̏ꍇ
-		//! @details VOgƂēo^
+		// インスタンス登録
+		//! @tparam TInterface 抽象型インターフェース
+		//! @param  instance   [in] 具象型インスタンス
+		//! @throws	 ResolveException 既に登録済みの場合
+		//! @details シングルトンとして登録される
 		//-------------------------------------------------------------
 		template<typename TInterface>
 		void registerInstance(std::shared_ptr<TInterface> instance);
 
 		//-------------------------------------------------------------
-		// CX^Xo^㏑
-		//! @tparam TInterface ی^C^[tF[X
-		//! @param  instance   [in] ی^CX^X
-		//! @details ɓo^ς݂̏ꍇł㏑Bo^̏ꍇ͐VKo^ƂȂB
+		// インスタンス登録上書き
+		//! @tparam TInterface 抽象型インターフェース
+		//! @param  instance   [in] 具象型インスタンス
+		//! @details 既に登録済みの場合でも上書きする。未登録の場合は新規登録となる。
 		//-------------------------------------------------------------
 		template<typename TInterface>
 		void replaceInstance(std::shared_ptr<TInterface> instance);
 
 		//-------------------------------------------------------------
-		// ^izˑotj
-		//! @tparam TInterface ی^C^[tF[X
-		//! @return ꂽCX^X
-		//! @throws ResolveException o^^AzˑAmCtTCN̏ꍇ
+		// 一括登録
+		//! @param  batch  [in] 登録を集めたビルダー
+		//! @throws ResolveException バッチ内または既存の登録と重複する型がある場合（重複した型を全て含む）
+		//! @details 登録情報の生成と重複検出はロック外で行い、対象シャードを順にロックして
+		//!          容量を確保してから挿入する。重複があれば 1 件も登録しない。
+		//!          全ての挿入が終わるまでロックを解放しないため、他スレッドからは全件が同時に見える。
+		//-------------------------------------------------------------
+		void registerBatch(RegistrationBatch batch);
+
+		//-------------------------------------------------------------
+		// モジュール追加（登録は遅延）
+		//! @tparam TModule  モジュール（Exports と static void configure(Container&) を持つ）
+		//! @throws ResolveException 公開する型が登録済み、または他のモジュールが公開済みの場合
+		//! @details 公開する型を記録するだけで、TModule::configure はまだ呼ばない。
+		//!          公開する型のいずれかが初めて解決されるか、validate で依存として参照された時点で
+		//!          1 回だけ呼ばれる（複数スレッドから同時に要求された場合も 1 回）。
+		//!          configure が例外を投げた場合は、それまでに configure が追加した登録を取り消して
+		//!          未読み込みのまま残し、次の要求で再実行する（replace 系で上書きした登録は戻さない）。
+		//!          configure 内から自モジュールの公開する型を要求しても再度の読み込みは行わない（未登録として扱う）。
+		//!          読み込み前に公開する型を個別に登録すると重複として拒否する（replace 系はモジュールを読み込んでから上書き）。
+		//-------------------------------------------------------------
+		template<typename TModule>
+		void addModule();
+
+		//-------------------------------------------------------------
+		// オープンジェネリック登録
+		//! @tparam TInterface       インターフェースのテンプレート（例: IRepository）
+		//! @tparam TImplementation  実装のテンプレート（例: Repository）
+		//! @param  cycle  [in] インスタンス化した登録のライフサイクル管理方法（デフォルトはTransient）
+		//! @throws ResolveException 同じテンプレートを登録済みの場合
+		//! @details 対応付けは事前に TSUKINO_DI_GENERIC(TInterface, TImplementation) で宣言すること。
+		//!          TInterface<X> が初めて要求された時点で registerType<TInterface<X>, TImplementation<X>>(cycle) を
+		//!          1 回だけ行い、以降は通常の登録として解決する（型ごとの登録が不要になる）。
+		//!          resolve / tryResolve は未登録だった場合にのみ要求を記録する（インスタンス化後は追加の処理なし）。
+		//!          要求とみなすのは resolve / tryResolve / resolveAsync / ScopedContext::resolve と、
+		//!          registerType などで登録した型の依存（Lazy<T> を含む）。
+		//!          TInterface<X> を個別に登録した場合はそちらが優先される。
+		//-------------------------------------------------------------
+		template<template<typename...> class TInterface, template<typename...> class TImplementation>
+		void registerGeneric(Lifecycle cycle = Lifecycle::Transient);
+
+		//-------------------------------------------------------------
+		// 消費側を限定した型登録（コンテキスト束縛）
+		//! @tparam TConsumer        依存する側の型（登録のキーとなる抽象型インターフェース）
+		//! @tparam TInterface       依存型
+		//! @tparam TImplementation  TConsumer の依存としてだけ使う具象型実装
+		//! @param  cycle  [in] ライフサイクル管理方法（デフォルトはTransient）
+		//! @throws ResolveException 同じ (TConsumer, TInterface) を登録済みの場合
+		//! @details 「TConsumer が TInterface を要求したら TImplementation を渡す」を登録する。
+		//!          TImplementation は (TConsumer, TInterface) ごとの非公開のキーで registerType と同様に登録し、
+		//!          TConsumer の登録情報の依存型リストの TInterface をそのキーへ置き換える（辺ごとに 1 回だけ決定）。
+		//!          解決時の条件判定はなく、TInterface を直接解決した場合や他の型の依存は従来どおり TInterface の登録を使う。
+		//!          TConsumer の登録の前後どちらに呼んでもよい（後の場合は登録済みの依存型リストを置き換える。
+		//!          構築済みの Singleton などは作り直さない）。fork した子コンテナの登録には親の束縛も適用される。
+		//!          Lazy<TInterface> 引数と ScopedContext::overrideType の依存は対象外。
+		//-------------------------------------------------------------
+		template<typename TConsumer, typename TInterface, typename TImplementation>
+		void registerContextual(Lifecycle cycle = Lifecycle::Transient);
+
+		//-------------------------------------------------------------
+		// デコレータ登録
+		//! @tparam TInterface  抽象型インターフェース（登録済みであること）
+		//! @tparam TDecorator  デコレータ（std::shared_ptr<TInterface> と TDeps... を受け取るコンストラクタを持つ）
+		//! @tparam TDeps       デコレータ自身の依存型リスト
+		//! @throws ResolveException 未登録、非同期ファクトリ、または Pooled の場合
+		//! @details 現在の登録を内側として包んだファクトリを登録時に 1 回だけ合成する。
+		//!          後から登録したデコレータほど外側になり、ライフサイクルは元の登録を引き継ぐ。
+		//!          replace 系で登録し直すとデコレータも外れる。
+		//!          Pooled はプールへ戻るのがデコレータとなり内側の reset() を呼べないため対象外
+		//!          （reset() を持つ合成済みの型を registerDecorated で登録すること）。
+		//-------------------------------------------------------------
+		template<typename TInterface, typename TDecorator, typename... TDeps>
+		void registerDecorator();
+
+		//-------------------------------------------------------------
+		// 静的デコレータ付き型登録
+		//! @tparam TInterface       抽象型インターフェース
+		//! @tparam TImplementation  具象型実装
+		//! @tparam TDecoratorList   Decorators<...>（内側から外側の順）
+		//! @tparam TDeps            具象型の依存型リスト（デコレータを通して転送される）
+		//! @param  cycle  [in] ライフサイクル管理方法（デフォルトはTransient）
+		//! @throws ResolveException 既に登録済みの場合
+		//! @details Decorated<TImplementation, TDecoratorList> を 1 回の確保で構築する。
+		//!          層ごとの std::function 呼び出しや仮想呼び出しは追加されない。
+		//-------------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename TDecoratorList, typename... TDeps>
+		void registerDecorated(Lifecycle cycle = Lifecycle::Transient);
+
+		//-------------------------------------------------------------
+		// Pooled 型のプール上限を設定
+		//! @tparam TInterface 抽象型インターフェース（Pooled で登録済みであること）
+		//! @param  capacity   [in] 共有リストに保持する空きオブジェクト数の上限（既定は 64）
+		//! @throws ResolveException 未登録、または Pooled でない場合
+		//! @details Pooled の解決結果は解放時に具象型の reset()（あれば）を呼んでプールへ戻り、
+		//!          次の解決で再利用される。上限を超えて返却された分は破棄される。
+		//!          各スレッドは型ごとに最大 ObjectPool::kLocalCapacity 個をロックなしで保持し、
+		//!          この分は上限に含まない（空き数の最大は capacity + スレッド数 × kLocalCapacity）。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		void setPoolCapacity(std::size_t capacity);
+
+		//-------------------------------------------------------------
+		// Cached 型の保持方針を設定
+		//! @param  policy  [in] 保持期間と合計サイズの上限（既定はどちらもなし）
+		//! @details Cached の解決結果は型ごとに 1 つ保持し、保持期間を過ぎるか合計サイズが上限を超えると
+		//!          最も長く参照されていない型から破棄する。破棄後の解決で再構築する。
+		//!          サイズは具象型の cacheSize()（あれば）、なければ sizeof(具象型) で数える。
+		//!          既に上限を超えている分は即座に破棄する。
+		//-------------------------------------------------------------
+		void setCachePolicy(const CachePolicy& policy);
+
+		//-------------------------------------------------------------
+		// Cached 型の保持状況を取得
+		//! @return ヒット・ミス・破棄の回数、保持中のインスタンス数と合計サイズ
+		//-------------------------------------------------------------
+		CacheStats cacheStats() const;
+
+		//-------------------------------------------------------------
+		// Cached 型の保持中のインスタンスを全て破棄
+		//! @details 解決済みのインスタンスは利用者が保持している間は有効
+		//-------------------------------------------------------------
+		void clearCache();
+
+		//-------------------------------------------------------------
+		// Replicated 型のレプリカの単位を設定
+		//! @tparam TInterface 抽象型インターフェース（Replicated で登録済みであること）
+		//! @param  granularity  [in] NUMA ノードごと（既定）または論理 CPU ごと
+		//! @throws ResolveException 未登録、または Replicated でない場合
+		//! @details Replicated の解決結果は呼び出しスレッドが実行中のノード（CPU）のレプリカとなり、
+		//!          各レプリカはそのノードで初めて解決したスレッドで構築される。
+		//!          ノードは Linux では sysfs、Windows では NUMA API から検出する（CpuTopology）。
+		//!          変更すると既存のレプリカは全て破棄される。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		void setReplicaGranularity(ReplicaGranularity granularity);
+
+		//-------------------------------------------------------------
+		// Replicated 型の全てのレプリカを一斉に更新
+		//! @tparam TInterface 抽象型インターフェース（Replicated で登録済みであること）
+		//! @throws ResolveException 未登録、または Replicated でない場合
+		//! @details 全てのレプリカを同時に無効化し、各ノードで次の解決時に再構築する
+		//!          （呼び出し後の解決で古いレプリカが返ることはない）。
+		//!          経路表やフィーチャーフラグの元データを更新した後に呼び出す。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		void refreshReplicas();
+
+		//-------------------------------------------------------------
+		// 型解決（循環依存検出付き）
+		//! @tparam TInterface 抽象型インターフェース
+		//! @return 解決されたインスタンス
+		//! @throws ResolveException 未登録型、循環依存、未知ライフサイクルの場合
 		//-------------------------------------------------------------
 		template<typename TInterface>
 		std::shared_ptr<TInterface> resolve();
 
 		//-------------------------------------------------------------
-		// ^o^ς݂mF
-		//! @tparam TInterface ی^C^[tF[X
-		//! @return o^ς݂Ȃ trueAo^Ȃ false
+		// 型解決（例外を投げない版）
+		//! @tparam TInterface 抽象型インターフェース
+		//! @return 解決結果（失敗時はエラーコードと失敗した型）
+		//! @details 登録確認と解決を 1 回の検索で行う。任意の依存の取得に使用する。
+		//!          解決エラー（未登録、循環依存、非同期専用）は例外を投げず、
+		//!          メッセージ文字列も生成しない。ファクトリ自身が投げた例外はそのまま伝播する。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		ResolveResult<TInterface> tryResolve();
+
+		//-------------------------------------------------------------
+		// Transient の一括解決（連続領域に構築）
+		//! @tparam TInterface 抽象型インターフェース
+		//! @param  count  [in] 構築する件数
+		//! @return 解決されたインスタンス（count 件）
+		//! @throws ResolveException 未登録型、循環依存、未知ライフサイクルの場合
+		//! @details 登録の検索と依存の解決は 1 回だけ行い、全てのインスタンスが同じ依存を共有する。
+		//!          registerType / registerCtor / RegistrationBatch で登録した Transient は、
+		//!          count 件を 1 つの連続領域に配置構築し、制御ブロックも 1 つにまとめる（確保は 2 回）。
+		//!          領域は全てのインスタンスが破棄されたときに解放される（1 件だけ保持すると全体が残る）。
+		//!          Transient 以外、registerFactory / デコレータなどの登録、インスタンス計上の有効時は
+		//!          1 件ずつ構築する（Transient 以外は resolve を count 回呼ぶのと同じ）。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		std::vector<std::shared_ptr<TInterface>> resolveN(std::size_t count);
+
+		//-------------------------------------------------------------
+		// 型が登録済みか確認
+		//! @tparam TInterface 抽象型インターフェース
+		//! @return 登録済み、または未読み込みのモジュールが公開していれば true、それ以外は false
+		//! @details モジュールの読み込みは行わない
 		//-------------------------------------------------------------
 		template<typename TInterface>
 		bool isRegistered() const;
 
 		//-------------------------------------------------------------
-		// L[ɂ^izˑotj
-		//! @param  key  [in] ^̃L[itype_indexj
-		//! @return  ꂽCX^X
-		//! @throws ResolveException o^^AzˑAmCtTCN̏ꍇ
+		// キーによる型解決（循環依存検出付き）
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return  解決されたインスタンス
+		//! @throws ResolveException 未登録型、循環依存、未知ライフサイクルの場合
 		//-------------------------------------------------------------
-		std::shared_ptr<void> resolveByKey(const std::type_index& key);
+		std::shared_ptr<void> resolveByKey(const TypeId& key);
 
 		//-------------------------------------------------------------
-		// ScopedContext 𐶐
-		//! @return ScopedContext RAII XR[vIuWFNg
+		// キーによる一括解決（resolveN の本体）
+		//! @param  key    [in] 型のキー（TypeId）
+		//! @param  count  [in] 構築する件数
+		//! @return 解決されたインスタンス（count 件）
+		//! @throws ResolveException 未登録型、循環依存、未知ライフサイクルの場合
+		//-------------------------------------------------------------
+		std::vector<std::shared_ptr<void>> resolveNByKey(const TypeId& key, std::size_t count);
+
+#if TSUKINO_DI_TYPE_INDEX
+		//-------------------------------------------------------------
+		// 動的に得た型による型解決（RTTI を使う呼び出し側向け）
+		//! @param  type  [in] 型（std::type_index）
+		//! @return  解決されたインスタンス
+		//! @throws ResolveException 未登録型、循環依存、未知ライフサイクルの場合
+		//! @details 登録（またはモジュールの追加）時に公開された対応表で TypeId に変換してから解決する
+		//-------------------------------------------------------------
+		std::shared_ptr<void> resolveByKey(const std::type_index& type);
+#endif
+
+		//-------------------------------------------------------------
+		// 登録表を共有する子コンテナを生成
+		//! @return 子コンテナ
+		//! @details 登録表は複製せず（O(1)）、子に登録がない型は親の登録を使う。
+		//!          子で register / replace した型は子だけの上書きとなり（親に登録済みでも例外にならない）、
+		//!          子のメモリは上書きした分のみ増える。テナントごとの差し替えなどに使う。
+		//!          親の Singleton / Pooled / PerThread / Cached / Replicated は親が保持して全ての子で共有する（親の登録で構築）。
+		//!          親の Transient / Scoped は子で構築するため、子で上書きした依存が反映される。
+		//!          子は親を shared_ptr で保持するため、親を先に手放しても子が破棄されるまで生存する。
+		//!          子が 1 つでも生存している間、親の登録の変更（register / replace / addModule など）は例外になる。
+		//!          子をさらに fork する場合は std::shared_ptr に移してから呼ぶ。
+		//! @throws ResolveException このコンテナが std::shared_ptr で所有されていない場合
+		//-------------------------------------------------------------
+		std::unique_ptr<Container> fork();
+
+		//-------------------------------------------------------------
+		// ScopedContext を生成
+		//! @return ScopedContext RAII スコープオブジェクト
 		//-------------------------------------------------------------
 		ScopedContext createScope();
 
+		//-------------------------------------------------------------
+		// スレッドローカル解決キャッシュの有効/無効を切り替え
+		//! @param  enabled  [in] true で有効（デフォルトは無効）
+		//! @details 有効時は resolveByKey の前段で、スレッドごとの小さな配列に
+		//!          登録情報と Singleton インスタンスをキャッシュする。
+		//!          replace 系の呼び出しでグローバルエポックが進み、全スレッドの
+		//!          キャッシュが一括で無効化される。
+		//-------------------------------------------------------------
+		void enableResolveCache(bool enabled);
+
+		//-------------------------------------------------------------
+		// 非同期解決で使用するスレッドプールを設定
+		//! @param  executor  [in] スレッドプール（nullptr で順次実行）
+		//! @details 設定時は resolveAsync で独立した依存をプール上で並行に待つ。
+		//!          解決開始前に設定し、コンテナより長く生存させること。
+		//-------------------------------------------------------------
+		void setAsyncExecutor(ThreadPoolExecutor* executor);
+
+		//-------------------------------------------------------------
+		// 構築時間計測の有効/無効を切り替え
+		//! @param  enabled  [in] true で有効（デフォルトは無効）
+		//! @details 有効時はファクトリ呼び出し（依存の解決は含まない）の所要時間を
+		//!          登録ごとに集計し、exportGraph の結果に反映する
+		//-------------------------------------------------------------
+		void enableConstructionTiming(bool enabled);
+
+		//-------------------------------------------------------------
+		// 解決トレースの有効/無効を切り替え
+		//! @param  enabled  [in] true で有効（デフォルトは無効）
+		//! @details 有効時は resolve / tryResolve / ScopedContext::resolve が型ごとに開始・終了イベントを
+		//!          入れ子の深さ付きでスレッドごとのリングバッファに記録する（ロックなし）。
+		//!          ResolveTrace::writeChromeJson で出力し、Perfetto などで開く。
+		//!          無効時の負荷は解決 1 回につき分岐 1 つ。
+		//-------------------------------------------------------------
+		void enableTracing(bool enabled);
+
+		//-------------------------------------------------------------
+		// 依存グラフを取得
+		//! @return 登録済みの全型と依存関係、計測済みの構築時間、解析結果
+		//! @details ウォームアップ後や実運用後に呼び出し、toDot / toJson で出力する
+		//-------------------------------------------------------------
+		DependencyGraph exportGraph() const;
+
+		//-------------------------------------------------------------
+		// 登録済みの依存グラフ全体を検証
+		//! @return 検出された全ての問題（未登録の依存、循環依存、長寿命の型が短寿命の型を保持する依存）
+		//! @details 起動時に 1 回呼び出す想定。問題がなければ以降の解決で循環依存検出を省略する。
+		//!          登録済みの型の依存を公開しているモジュールは検証前に読み込む（参照されないモジュールは読み込まない）。
+		//!          register / replace を呼ぶと検証済み状態は解除され、再度 validate が必要となる。
+		//-------------------------------------------------------------
+		ValidationReport validate();
+
+		//-------------------------------------------------------------
+		// 登録マニフェストを取得
+		//! @return 登録済みの全型（名前・ライフサイクル・依存・密な ID）とトポロジカル順
+		//! @details toBinary / toJson で保存し、ビルド間の差分確認や次回起動時の loadManifest に使う。
+		//!          ID は処理系の型名順で、同じビルドなら同じ登録に対して同じ値になる。
+		//-------------------------------------------------------------
+		ContainerManifest exportManifest() const;
+
+		//-------------------------------------------------------------
+		// 登録マニフェストを適用
+		//! @param  manifest  [in] 同じビルドで exportManifest したマニフェスト
+		//! @return 適用できた場合 true
+		//! @details 作成時に検証済みで、ビルドのハッシュが一致する場合に、保存された依存の計画と
+		//!          トポロジカル順を使って検証する。依存の計画は登録と 1 件ずつ照合し、
+		//!          循環がないことは保存された順序が依存の順に並んでいることで、寿命の検査は
+		//!          その順序での 1 回の走査で確認する（validate の DFS・型ごとの探索より軽い）。
+		//!          ファイルの内容は信用しないため、改ざんや古いマニフェストで循環検出が無効になることはない。
+		//!          一致しない、または確認できない場合は何もしない（validate を呼ぶこと）。
+		//-------------------------------------------------------------
+		bool loadManifest(const ContainerManifest& manifest);
+
+		//-------------------------------------------------------------
+		// シャードのロックの計測結果を取得
+		//! @return 呼び出し箇所ごとの取得回数・競合回数・待ち時間・保持時間・最大待機スレッド数
+		//! @details TSUKINO_DI_LOCK_PROFILING を 1 にしてビルドした場合のみ計測する（無効時は enabled_ が false で空）。
+		//!          全シャードの合計値。競合していない取得の待ち時間は 0 として扱う。
+		//-------------------------------------------------------------
+		LockProfile lockProfile() const;
+
+		//-------------------------------------------------------------
+		// シャードのロックの計測結果を 0 に戻す
+		//! @details ウォームアップ後など、計測したい区間の直前に呼び出す
+		//-------------------------------------------------------------
+		void resetLockProfile();
+
+		//-------------------------------------------------------------
+		// 型ごとのインスタンス計上値を取得
+		//! @return 型ごとの構築数・破棄されていない数・概算サイズ・それぞれの最大値
+		//! @details TSUKINO_DI_INSTANCE_ACCOUNTING を 1 にしてビルドした場合のみ計上する（無効時は enabled_ が false で空）。
+		//!          構築したインスタンスを包み、最後の参照が外れた時点で減算する（コンテナが保持する Singleton なども含む）。
+		//!          サイズは cacheSize() があればその値、なければ sizeof(TImplementation)。
+		//!          1 回以上構築した、このコンテナの登録のみ（fork した子で構築した継承登録の分は親に計上）。
+		//!          replace した型は新しい登録の分から数え直す。
+		//-------------------------------------------------------------
+		InstanceAccounting instanceAccounting() const;
+
+		//-------------------------------------------------------------
+		// 非同期ファクトリ登録
+		//! @tparam  TInterface  抽象型インターフェース
+		//! @tparam  TDeps       依存型リスト
+		//! @param   factory [in] 依存を受け取り Task<std::shared_ptr<TInterface>> を返す関数
+		//! @param   cycle   [in] ライフサイクル管理方法（デフォルトはTransient）
+		//! @throws  ResolveException 既に登録済みの場合
+		//! @details resolveAsync でのみ解決可能。Singleton の初期化は全待機者で共有される。
+		//!          コルーチンが利用可能な翻訳単位（C++20）でのみ使用できる。
+		//!          宣言はビルド設定によらず共通（C++17 のライブラリと C++20 の利用側でクラス定義を一致させる）。
+		//-------------------------------------------------------------
+		template<typename TInterface, typename... TDeps, typename TFactory>
+		void registerAsyncFactory(TFactory factory, Lifecycle cycle = Lifecycle::Transient);
+
+		//-------------------------------------------------------------
+		// 非同期型解決（循環依存検出付き）
+		//! @tparam TInterface 抽象型インターフェース
+		//! @return 解決されたインスタンスを返すタスク
+		//! @throws ResolveException 未登録型、循環依存の場合（co_await 時）
+		//! @details 独立した依存は setAsyncExecutor のプール上で並行に待つ。
+		//!          コルーチンが利用可能な翻訳単位（C++20）でのみ使用できる。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		Task<std::shared_ptr<TInterface>> resolveAsync();
+
 	private:
 
+		//---------------------------------------------------------
+		//! @struct ConstructionStats
+		//! @brief  登録ごとの構築時間の集計値
+		//---------------------------------------------------------
+		struct ConstructionStats {
+			std::atomic<std::uint64_t> count_{ 0 };			// 構築回数
+			std::atomic<std::uint64_t> totalNanos_{ 0 };	// 構築時間の合計
+			std::atomic<std::uint64_t> maxNanos_{ 0 };		// 構築時間の最大値
+
+			//! @brief 1 回分の構築時間を記録
+			void record(std::uint64_t nanos) {
+				count_.fetch_add(1, std::memory_order_relaxed);
+				totalNanos_.fetch_add(nanos, std::memory_order_relaxed);
+				std::uint64_t prev = maxNanos_.load(std::memory_order_relaxed);
+				while (prev < nanos && !maxNanos_.compare_exchange_weak(prev, nanos, std::memory_order_relaxed)) {}
+			}
+		};
+
 		//---------------------------------------------------------
 		//! @struct Registration
-		//! @brief  o^\
-		//! @details CtTCNƃt@Ng֐ێ
+		//! @brief  登録情報構造体
+		//! @details ライフサイクルとファクトリ関数を保持
 		//---------------------------------------------------------
 		struct Registration {
-			Lifecycle cycle_ = Lifecycle::Transient;												// CtTCN(ftHgTransient)
-			std::vector<std::type_index> deps_;														// ˑ^XgiȂȂj
-			std::function<std::shared_ptr<void>(const std::vector<std::shared_ptr<void>>&)> ctor_;	// t@Ng֐
+			Lifecycle cycle_ = Lifecycle::Transient;												// ライフサイクル(デフォルトはTransient)
+			std::vector<TypeId> deps_{};													// 依存型リスト（空なら引数なし）
+			std::function<std::shared_ptr<void>(const std::vector<std::shared_ptr<void>>&)> ctor_{};	// ファクトリ関数
+			std::shared_ptr<void> async_{};															// 非同期ファクトリ（型消去、非同期登録時のみ）
+			std::shared_ptr<ConstructionStats> stats_ = std::make_shared<ConstructionStats>();		// 構築時間の集計値
+			std::shared_ptr<ObjectPool> pool_{};														// オブジェクトプール（Pooled の場合のみ）
+			std::shared_ptr<PerThreadSlot> perThread_{};												// スレッドごとの格納位置（PerThread の場合のみ）
+			InstanceCache::SizeFn size_ = nullptr;													// インスタンスのサイズ取得（Cached の場合のみ、なければ 0 とみなす）
+			std::shared_ptr<ReplicaSet> replicas_{};													// ノードごとのレプリカ（Replicated の場合のみ）
+			detail::BulkLayout bulk_{};																// 連続領域への一括構築（resolveN、なければ 1 件ずつ構築）
+			std::uint32_t refDeps_ = 0;																// 参照で受け取る依存（deps_ の位置のビット、Singleton 以外は構築後に破棄されうる）
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+			std::shared_ptr<detail::AccountingCounters> accounting_ = std::make_shared<detail::AccountingCounters>();	// インスタンス計上値
+#endif
+		};
+
+		//---------------------------------------------------------
+		// 登録情報を確定（Pooled / PerThread / Replicated の場合は格納先を生成）
+		//! @param  reg    [in] 登録情報
+		//! @param  reset  [in] プール返却時に呼ぶフック
+		//! @param  size   [in] Cached のインスタンスのサイズ取得
+		//! @return 共有する登録情報
+		//---------------------------------------------------------
+		static std::shared_ptr<const Registration> makeRegistration(Registration reg, ObjectPool::ResetFn reset = nullptr, InstanceCache::SizeFn size = nullptr);
+
+		//---------------------------------------------------------
+		// 登録情報を登録表へ追加（register / replace 系の共通処理）
+		//! @param  type     [in] 型のキー（TypeId）
+		//! @param  reg      [in] 登録情報
+		//! @param  replace  [in] true なら上書きし、旧 Singleton / Cached と解決キャッシュを破棄
+		//! @throws ResolveException replace が false で登録済みの場合
+		//---------------------------------------------------------
+		void addRegistration(const TypeId& type, std::shared_ptr<const Registration> reg, bool replace);
+
+		//---------------------------------------------------------
+		// 型ごとの記述子から登録（registerType / registerCtor の本体）
+		//! @param  descriptor  [in] bindType / bindCtor で生成した記述子
+		//! @param  replace     [in] true なら上書き
+		//! @details テンプレート側は記述子（関数ポインタと依存型の静的配列）を作るだけとし、
+		//!          登録情報の生成・ロック・重複確認は型によらずこの 1 か所で行う
+		//---------------------------------------------------------
+		void registerDescriptor(const StaticRegistration& descriptor, bool replace);
+
+		//---------------------------------------------------------
+		// インスタンス登録の本体
+		//! @param  type      [in] 型のキー（TypeId）
+		//! @param  instance  [in] インスタンス（抽象型を指すポインタ）
+		//! @param  replace   [in] true なら上書き
+		//---------------------------------------------------------
+		void registerInstanceImpl(const TypeId& type, std::shared_ptr<void> instance, bool replace);
+
+		//---------------------------------------------------------
+		// Lazy<T> 引数を持つ型の登録情報を生成（コンテナを保持するファクトリ）
+		//! @param  cycle  [in] ライフサイクル
+		//! @return 登録情報
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation>
+		std::shared_ptr<const Registration> makeLazyRegistration(Lifecycle cycle);
+
+		//---------------------------------------------------------
+		// 型が登録済みか確認（isRegistered の本体）
+		//! @param  type  [in] 型のキー（TypeId）
+		//! @return 登録済み、未読み込みのモジュールが公開、または fork 元に登録済みなら true
+		//---------------------------------------------------------
+		bool isRegisteredByKey(const TypeId& type) const;
+
+		static constexpr std::size_t kShardCount = 16;		// シャード数（2 の冪）
+		static constexpr std::size_t kCacheLineSize = 64;	// キャッシュライン長（false sharing 回避用）
+
+		//---------------------------------------------------------
+		//! @struct  Shard
+		//! @brief   型ハッシュで分割された登録情報・シングルトンの格納単位
+		//! @details シャードごとにロックを持ち、キャッシュライン境界に揃える。
+		//!          異なるシャードの型同士は解決・生成で互いにブロックしない。
+		//---------------------------------------------------------
+		struct alignas(kCacheLineSize) Shard {
+			std::unordered_map<TypeId, std::shared_ptr<const Registration>> registrations_;	// 登録情報マップ
+			std::unordered_map<TypeId, std::shared_ptr<void>> singletons_;	// シングルトンインスタンスマップ
+			mutable std::shared_mutex mutex_;										// シャード単位のミューテックス
+		};
+
+		//---------------------------------------------------------
+		// 型キーに対応するシャードを取得
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 対応するシャード
+		//---------------------------------------------------------
+		Shard& shardFor(const TypeId& key);
+		const Shard& shardFor(const TypeId& key) const;
+
+#if TSUKINO_DI_LOCK_PROFILING
+		using ExclusiveLock = detail::ProfiledLock<std::unique_lock<std::shared_mutex>>;	// 計測付き書き込みロック
+		using SharedLock = detail::ProfiledLock<std::shared_lock<std::shared_mutex>>;		// 計測付き読み取りロック
+#else
+		using ExclusiveLock = std::unique_lock<std::shared_mutex>;	// 書き込みロック
+		using SharedLock = std::shared_lock<std::shared_mutex>;		// 読み取りロック
+#endif
+
+		//---------------------------------------------------------
+		// シャードの書き込みロックを取得
+		//! @param  shard  [in] 対象シャード
+		//! @param  site   [in] 呼び出し箇所（計測有効時のみ使用）
+		//! @return ロック
+		//---------------------------------------------------------
+		ExclusiveLock lockExclusive(const Shard& shard, LockSite site) const;
+
+		//---------------------------------------------------------
+		// シャードの読み取りロックを取得
+		//! @param  shard  [in] 対象シャード
+		//! @param  site   [in] 呼び出し箇所（計測有効時のみ使用）
+		//! @return ロック
+		//---------------------------------------------------------
+		SharedLock lockShared(const Shard& shard, LockSite site) const;
+
+		//---------------------------------------------------------
+		// 型キーに対応するシャード番号を取得
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return シャード番号
+		//---------------------------------------------------------
+		static std::size_t shardIndex(const TypeId& key);
+
+		//---------------------------------------------------------
+		// 型キーに対応する登録情報を取得
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 登録情報（未登録なら nullptr）
+		//---------------------------------------------------------
+		std::shared_ptr<const Registration> findRegistration(const TypeId& key) const;
+
+		//---------------------------------------------------------
+		// 型キーに対応する登録情報を取得（未登録ならモジュールを読み込んで再検索、それでもなければ親から取得）
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 登録情報（モジュールにも親にもなければ nullptr）
+		//---------------------------------------------------------
+		std::shared_ptr<const Registration> findOrLoadRegistration(const TypeId& key);
+
+		//---------------------------------------------------------
+		// オープンジェネリック登録の本体
+		//! @param  genericKey  [in] インターフェースのテンプレートの識別子
+		//! @param  cycle       [in] ライフサイクル
+		//---------------------------------------------------------
+		void registerGenericImpl(const TypeId& genericKey, Lifecycle cycle);
+
+		//---------------------------------------------------------
+		// コンテキスト束縛を記録し、登録済みの消費側の依存型リストを置き換える
+		//! @param  consumer    [in] 依存する側の型
+		//! @param  dependency  [in] 依存型
+		//! @param  key         [in] 置き換え先の登録のキー
+		//---------------------------------------------------------
+		void registerContextualImpl(const TypeId& consumer, const TypeId& dependency, const TypeId& key);
+
+		//---------------------------------------------------------
+		// 依存型リストにコンテキスト束縛を適用
+		//! @param  consumer  [in]     依存する側の型
+		//! @param  deps      [in,out] 依存型リスト
+		//! @return 置き換えた依存があれば true
+		//! @details 子コンテナの束縛を親より優先する
+		//---------------------------------------------------------
+		bool applyContextual(const TypeId& consumer, std::vector<TypeId>& deps) const;
+
+		//---------------------------------------------------------
+		// 登録情報にコンテキスト束縛を適用（解決計画の確定）
+		//! @param  consumer  [in] 依存する側の型
+		//! @param  reg       [in] 登録情報
+		//! @return 束縛がなければ reg、あれば依存型リストを置き換えた複製
+		//---------------------------------------------------------
+		std::shared_ptr<const Registration> planRegistration(const TypeId& consumer, std::shared_ptr<const Registration> reg) const;
+
+		//---------------------------------------------------------
+		//! @struct GenericUse
+		//! @brief  オープンジェネリックのインスタンスの要求（解決で未登録だった場合に記録する）
+		//---------------------------------------------------------
+		struct GenericUse {
+			TypeId genericKey_;					// インターフェースのテンプレートの識別子
+			ModuleConfigureFn materialize_;		// 型を登録する関数
+		};
+
+		//---------------------------------------------------------
+		// オープンジェネリックのインスタンスの要求を記録
+		//! @param  genericKey   [in] インターフェースのテンプレートの識別子
+		//! @param  type         [in] 要求された型
+		//! @param  materialize  [in] 型を登録する関数
+		//! @details 登録済みのテンプレートなら未読み込みのモジュールとして公開し、初回の解決で登録する
+		//---------------------------------------------------------
+		void noteGenericUse(const TypeId& genericKey, const TypeId& type, ModuleConfigureFn materialize);
+
+		//---------------------------------------------------------
+		// オープンジェネリック登録のライフサイクルを取得
+		//! @param  genericKey  [in]  インターフェースのテンプレートの識別子
+		//! @param  cycle       [out] ライフサイクル
+		//! @return 登録済みなら true
+		//---------------------------------------------------------
+		bool findGeneric(const TypeId& genericKey, Lifecycle& cycle) const;
+
+		//---------------------------------------------------------
+		// オープンジェネリックのインスタンスを登録（未読み込みのモジュールとして呼ばれる）
+		//! @tparam T  要求された型（TInterface<X>）
+		//! @param  container  [in] 登録先のコンテナ
+		//---------------------------------------------------------
+		template<typename T>
+		static void materializeGeneric(Container& container);
+
+		//---------------------------------------------------------
+		// モジュール追加の本体
+		//! @param  configure  [in] モジュールの登録関数
+		//! @param  exports    [in] 公開する型
+		//---------------------------------------------------------
+		void addModuleImpl(ModuleConfigureFn configure, std::vector<TypeId> exports);
+
+		//---------------------------------------------------------
+		// 型を公開している未読み込みのモジュールを読み込む
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return モジュールを読み込んだ（または他スレッドが読み込み終えた）場合 true
+		//---------------------------------------------------------
+		bool loadModuleFor(const TypeId& key);
+
+		//---------------------------------------------------------
+		// 型を公開している未読み込みのモジュールがあるか確認
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 未読み込みのモジュールが公開していれば true
+		//---------------------------------------------------------
+		bool isExportedByPendingModule(const TypeId& key) const;
+
+		//---------------------------------------------------------
+		// 型が未読み込みのモジュールの公開する型として予約されているか確認
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 呼び出しスレッドが読み込み中ではないモジュールが公開していれば true
+		//! @details オープンジェネリックのインスタンス化は個別の登録を優先するため対象外
+		//---------------------------------------------------------
+		bool isReservedByModule(const TypeId& key) const;
+
+		//---------------------------------------------------------
+		// 登録を変更できるか確認（fork した子が生存している間は拒否）
+		//! @throws ResolveException 子が生存している場合（このコンテナのモジュールの読み込み中は除く）
+		//---------------------------------------------------------
+		void checkNotForked() const;
+
+		//---------------------------------------------------------
+		// 登録を取り消す（読み込みに失敗したモジュールの登録の巻き戻し）
+		//! @param  types  [in] 取り消す型のキー
+		//---------------------------------------------------------
+		void removeRegistrations(const std::vector<TypeId>& types);
+
+		//---------------------------------------------------------
+		// 全スレッドの解決キャッシュを無効化（グローバルエポックを進める）
+		//---------------------------------------------------------
+		static void invalidateResolveCache();
+
+		//---------------------------------------------------------
+		// 登録内容の変更を記録（検証済み状態を解除し、解決キャッシュを無効化）
+		//! @details 追加のみの登録でも呼ぶ（fork した子の登録は親の登録を隠すため、
+		//!          キャッシュ済みの親のインスタンスや解決計画を返さないようにする）
+		//---------------------------------------------------------
+		void markRegistrationsChanged();
+
+		//---------------------------------------------------------
+		// 登録内容の世代を取得
+		//! @return 登録内容の世代（fork したコンテナは親の変更でも進む）
+		//---------------------------------------------------------
+		std::uint64_t registrationGeneration() const;
+
+		//---------------------------------------------------------
+		// 現在の登録内容が検証済みか確認
+		//! @return 最後の変更以降に validate が成功していれば true
+		//---------------------------------------------------------
+		bool isValidated() const;
+
+		//---------------------------------------------------------
+		// 全シャードの登録情報をスナップショット
+		//! @return (型, 登録情報) の一覧（名前順、fork したコンテナは子で上書きしていない親の登録を含む）
+		//---------------------------------------------------------
+		std::vector<std::pair<TypeId, std::shared_ptr<const Registration>>> snapshotRegistrations() const;
+
+		//---------------------------------------------------------
+		// 登録内容のハッシュを計算
+		//! @param  regs  [in] snapshotRegistrations の結果
+		//! @return 型名・ライフサイクル・依存から計算したハッシュ
+		//---------------------------------------------------------
+		static std::uint64_t registrationFingerprint(const std::vector<std::pair<TypeId, std::shared_ptr<const Registration>>>& regs);
+
+		//---------------------------------------------------------
+		// キーによる型解決の本体
+		//! @param  key    [in]  型のキー（TypeId）
+		//! @param  error  [out] nullptr なら解決エラーを例外で通知、それ以外はここに格納して nullptr を返す
+		//! @param  lazy   [in]  Lazy<T> からの解決なら true（検証済みでも循環検出のガードを取る）
+		//! @param  generic [in] オープンジェネリックの型なら要求（未登録の場合のみ記録して解決し直す）
+		//! @return 解決されたインスタンス
+		//---------------------------------------------------------
+		std::shared_ptr<void> resolveImpl(const TypeId& key, ResolveError* error, bool lazy = false, const GenericUse* generic = nullptr);
+
+		//---------------------------------------------------------
+		// Lazy<T> からの型解決
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 解決されたインスタンス
+		//! @details Lazy<T> の辺は依存グラフに含まれず validate で循環がないことを保証できないため、
+		//!          検証済みでも解決する型とその内側の解決を循環検出のスタックに積む
+		//!          （構築中に get() で自身の連鎖へ戻った場合は循環依存の例外になる）
+		//---------------------------------------------------------
+		std::shared_ptr<void> resolveLazyByKey(const TypeId& key);
+
+		//---------------------------------------------------------
+		// ファクトリを呼び出してインスタンスを構築（計測有効時は時間を記録、計上有効時は包む）
+		//! @param  key   [in] 型のキー（TypeId）
+		//! @param  reg   [in] 登録情報
+		//! @param  args  [in] 依存インスタンスリスト
+		//! @return 構築されたインスタンス
+		//---------------------------------------------------------
+		std::shared_ptr<void> construct(const TypeId& key, const Registration& reg, const std::vector<std::shared_ptr<void>>& args) const;
+
+		//---------------------------------------------------------
+		// 連続領域に count 件を配置構築（計測有効時は 1 件ごとに時間を記録）
+		//! @param  reg     [in]  登録情報（bulk_ を持つこと）
+		//! @param  args    [in]  依存インスタンスリスト（全件で共有）
+		//! @param  count   [in]  構築する件数
+		//! @param  result  [out] 構築したインスタンスの追加先（制御ブロックを共有するエイリアス）
+		//---------------------------------------------------------
+		void constructBulk(const Registration& reg, const std::vector<std::shared_ptr<void>>& args, std::size_t count, std::vector<std::shared_ptr<void>>& result) const;
+
+		//---------------------------------------------------------
+		// 参照で受け取る依存が Singleton か確認（検証済みなら省略）
+		//! @param  key  [in] 構築する型のキー（TypeId）
+		//! @param  reg  [in] 登録情報
+		//! @throws ResolveException Singleton 以外の依存を参照で受け取る場合（構築後に参照先が破棄されうる）
+		//---------------------------------------------------------
+		void checkReferenceDeps(const TypeId& key, const Registration& reg) const;
+
+		static constexpr std::size_t kResolveCacheSlots = 64;	// 解決キャッシュのスロット数（2 の冪）
+
+		//---------------------------------------------------------
+		//! @struct  ResolveCacheSlot
+		//! @brief   スレッドローカル解決キャッシュの 1 エントリ
+		//! @details owner_ / key_ / epoch_ が全て一致した場合のみ有効
+		//---------------------------------------------------------
+		struct ResolveCacheSlot {
+			const Container* owner_ = nullptr;					// キャッシュしたコンテナ
+			TypeId key_;				// キャッシュした型
+			std::uint64_t epoch_ = 0;							// キャッシュ時のエポック
+			std::shared_ptr<const Registration> plan_;			// 登録情報
+			std::shared_ptr<void> singleton_;					// Singleton インスタンス（生成済みの場合）
 		};
 
-		std::unordered_map<std::type_index, Registration> registrations_;				// o^}bv
-		std::unordered_map<std::type_index, std::shared_ptr<void>> singletons_;			// VOgCX^X}bv
-		mutable std::shared_mutex mutex_;												// XbhZ[tp~[ebNX
+		static thread_local std::array<ResolveCacheSlot, kResolveCacheSlots> tl_resolve_cache_;	// スレッドローカル解決キャッシュ
+		static std::atomic<std::uint64_t> resolve_cache_epoch_;									// グローバルエポック
+
+		std::array<Shard, kShardCount> shards_;				// 型ハッシュで分割したシャード配列
+		InstanceCache instance_cache_;						// Cached のインスタンス
+		std::shared_ptr<Container> parent_;					// fork 元のコンテナ（未登録の型の問い合わせ先、子より先に破棄しない）
+		std::atomic<std::size_t> live_forks_{ 0 };			// 生存している fork した子の数（登録の変更の拒否用）
+		std::atomic<bool> resolve_cache_enabled_{ false };	// 解決キャッシュ有効フラグ
+		ThreadPoolExecutor* async_executor_ = nullptr;		// 非同期解決の実行先
+		std::atomic<bool> construction_timing_enabled_{ false };	// 構築時間計測フラグ
+		std::atomic<bool> tracing_enabled_{ false };				// 解決トレースフラグ
+		std::atomic<std::uint64_t> registration_generation_{ 1 };	// 登録内容の世代（変更のたびに進む）
+		std::atomic<std::uint64_t> validated_generation_{ 0 };		// 検証に成功した世代
+#if TSUKINO_DI_LOCK_PROFILING
+		mutable std::array<detail::LockSiteCounters, kLockSiteCount> lock_counters_;	// 呼び出し箇所ごとのロック計測値
+#endif
+
+		//---------------------------------------------------------
+		//! @struct  PendingModule
+		//! @brief   未読み込みのモジュール
+		//---------------------------------------------------------
+		struct PendingModule {
+			ModuleConfigureFn configure_ = nullptr;	// 登録関数
+			std::vector<TypeId> exports_;	// 公開する型
+			std::mutex mutex_;						// 読み込み中の他スレッドを待たせる
+			bool loaded_ = false;					// 読み込み済みフラグ
+			bool generic_ = false;					// オープンジェネリックのインスタンス化（個別の登録を優先する）
+		};
+
+		std::unordered_map<TypeId, std::shared_ptr<PendingModule>> pending_modules_;	// 公開型 → 未読み込みのモジュール
+		mutable std::mutex modules_mutex_;														// pending_modules_ 保護用
+		std::atomic<bool> has_pending_modules_{ false };										// 未読み込みのモジュールの有無（未登録時の早期判定用）
+		std::unordered_map<TypeId, Lifecycle> generics_;								// オープンジェネリック登録（modules_mutex_ で保護）
+		std::atomic<bool> has_generics_{ false };										// オープンジェネリック登録の有無（fork した子の解決時の早期判定用）
+		std::unordered_map<TypeId, std::vector<std::pair<TypeId, ModuleConfigureFn>>> generic_uses_;	// 登録前に要求されたインスタンス（modules_mutex_ で保護）
+		std::unordered_map<TypeId, std::vector<std::pair<TypeId, TypeId>>> contextual_;	// 消費側 → (依存型, 置き換え先のキー)（modules_mutex_ で保護）
+		std::atomic<bool> has_contextual_{ false };										// コンテキスト束縛の有無（登録時の早期判定用）
+
+		// 非同期ファクトリと Singleton 共有初期化状態（定義はコルーチン有効時のみ）
+		struct AsyncRegistration;
+
+		//---------------------------------------------------------
+		// キーによる非同期型解決
+		//! @param  key    [in] 型のキー（TypeId）
+		//! @param  chain  [in] 解決中の型の連鎖（循環依存検出用）
+		//! @return 解決されたインスタンスを返すタスク
+		//---------------------------------------------------------
+		Task<std::shared_ptr<void>> resolveAsyncByKey(TypeId key, std::vector<TypeId> chain);
+
+		//---------------------------------------------------------
+		// 依存を並行に解決してインスタンスを非同期に構築
+		//! @param  key    [in] 型のキー（TypeId）
+		//! @param  reg    [in] 登録情報
+		//! @param  chain  [in] 解決中の型の連鎖（key を含む）
+		//! @return 構築されたインスタンスを返すタスク
+		//---------------------------------------------------------
+		Task<std::shared_ptr<void>> constructAsync(TypeId key, std::shared_ptr<const Registration> reg, std::vector<TypeId> chain);
 	};
 }// namespace TsukinoDIContainer
 namespace TsukinoDIContainer {
 	//-------------------------------------------------------------
-	//! @brief ev[g֐̎
+	//! @brief テンプレート関数の実装
 	//-------------------------------------------------------------
 	template<typename TInterface, typename TImplementation>
 	inline void Container::registerType(Lifecycle cycle_) {
-		std::unique_lock<std::shared_mutex> lock(mutex_); // XbhZ[t
-		// o^ς݊mF
-		const auto type = std::type_index(typeid(TInterface));
-		if (registrations_.find(type) != registrations_.end()) {
-			// ɓo^ς݂ȂOA㏑ꍇReplacegpB
-			throw ResolveException("Type already registered: " + std::string(type.name()));
-		}
-		// o^
-		registrations_[type] = {
-			cycle_,
-			{}, // ˑȂ
-			[](const std::vector<std::shared_ptr<void>>&) {
-				return std::make_shared<TImplementation>();
-			}
-		};
-
+		using Ctor = detail::AutoCtor<TInterface, TImplementation>;
+		if constexpr (!Ctor::hasLazy()) {
+			// 型ごとに生成するのは関数ポインタと依存型の静的配列のみ（登録処理は非テンプレート）
+			registerDescriptor(bindType<TInterface, TImplementation>(cycle_), false);
+		}
+		else {
+			// Lazy<T> 引数はこのコンテナから解決するため、コンテナを保持するファクトリで登録
+			Ctor::noteGenerics(*this);	// オープンジェネリックの依存はここで要求を記録
+			addRegistration(typeId<TInterface>(), makeLazyRegistration<TInterface, TImplementation>(cycle_), false);
+		}
 	}
 
 	//-------------------------------------------------------------
-	//! @brief ^o^㏑
+	//! @brief 型登録上書き
 	//-------------------------------------------------------------
 	template<typename TInterface, typename TImplementation>
 	inline void Container::replaceType(Lifecycle cycle_) {
-		std::unique_lock<std::shared_mutex> lock(mutex_); // XbhZ[t
-		//^nbVL[ƂĎ擾
-		const auto type = std::type_index(typeid(TInterface));
-		// o^
-		registrations_[type] = {
-			cycle_,
-			{}, // ˑȂ
-			[](const std::vector<std::shared_ptr<void>>&) {
-				return std::make_shared<TImplementation>();
+		using Ctor = detail::AutoCtor<TInterface, TImplementation>;
+		if constexpr (!Ctor::hasLazy()) {
+			registerDescriptor(bindType<TInterface, TImplementation>(cycle_), true);
+		}
+		else {
+			Ctor::noteGenerics(*this);	// オープンジェネリックの依存はここで要求を記録
+			addRegistration(typeId<TInterface>(), makeLazyRegistration<TInterface, TImplementation>(cycle_), true);
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Lazy<T> 引数を持つ型の登録情報を生成
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation>
+	inline std::shared_ptr<const Container::Registration> Container::makeLazyRegistration(Lifecycle cycle) {
+		using Ctor = detail::AutoCtor<TInterface, TImplementation>;
+		Registration reg{
+			cycle,
+			Ctor::deps(), // コンストラクタから推論した依存型リスト
+			[this](const std::vector<std::shared_ptr<void>>& args) {
+				return Ctor::create(args, [this](const TypeId& key) { return resolveLazyByKey(key); });
 			}
 		};
-		//  Singleton KjiŐVKj 
-		singletons_.erase(type);
+		reg.refDeps_ = Ctor::refMask();
+		return makeRegistration(std::move(reg), detail::ResetHook<TInterface, TImplementation>::get(), detail::SizeHook<TInterface, TImplementation>::get());
+	}
+
+	//-------------------------------------------------------------
+	//! @brief コンストラクタ呼び出し補助
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation, typename... TDeps>
+	inline void Container::registerCtor(Lifecycle cycle) {
+		// 登録処理は非テンプレート（既に登録済みなら例外、上書きしたい場合はReplaceCtorを使用させる）
+		registerDescriptor(bindCtor<TInterface, TImplementation, TDeps...>(cycle), false);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief コンストラクタ呼び出し補助上書き
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation, typename... TDeps>
+	inline void Container::replaceCtor(Lifecycle cycle_) {
+		registerDescriptor(bindCtor<TInterface, TImplementation, TDeps...>(cycle_), true);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief インスタンス登録
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	inline void Container::registerInstance(std::shared_ptr<TInterface> instance) {
+		// 既に登録済みなら例外、上書きしたい場合はReplaceInstanceを使用させる。
+		registerInstanceImpl(typeId<TInterface>(), std::move(instance), false);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief インスタンス登録上書き
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	inline void Container::replaceInstance(std::shared_ptr<TInterface> instance) {
+		registerInstanceImpl(typeId<TInterface>(), std::move(instance), true);
 	}
 
 	//-------------------------------------------------------------
-	//! @brief RXgN^Ăяo⏕
-	//! @tparam TImplementation ی^
-	//! @tparam TDeps         ˑ^Xg
-	//! @param  args          [in] ˑCX^XXg
-	//! @param  I             CfbNXV[PX
-	//! @return ꂽCX^X
+	//! @brief デコレータ呼び出し補助
+	//! @tparam TInterface  抽象型インターフェース
+	//! @tparam TDecorator  デコレータ
+	//! @tparam TDeps       デコレータの依存型リスト
+	//! @param  inner       [in] 内側のインスタンス
+	//! @param  args        [in] 依存インスタンスリスト（内側の依存の後ろにデコレータの依存が並ぶ）
+	//! @param  offset      [in] デコレータの依存の開始位置
+	//! @return 生成されたインスタンス
 	//-------------------------------------------------------------
-	template<typename TImplementation, typename... TDeps, std::size_t... I>
-	inline static std::shared_ptr<void> callCtorImpl(
+	template<typename TInterface, typename TDecorator, typename... TDeps, std::size_t... I>
+	inline static std::shared_ptr<void> callDecoratorImpl(
+		std::shared_ptr<void> inner,
 		const std::vector<std::shared_ptr<void>>& args,
+		std::size_t offset,
 		std::index_sequence<I...>)
 	{
-		// ˑCX^XÓI|C^LXgăRXgN^ɓn
-		return std::make_shared<TImplementation>(
-			std::static_pointer_cast<TDeps>(args[I])...
+		std::shared_ptr<TInterface> created = std::make_shared<TDecorator>(
+			std::static_pointer_cast<TInterface>(inner),
+			std::static_pointer_cast<TDeps>(args[offset + I])...
 		);
+		return created;
 	}
 
 	//-------------------------------------------------------------
-	//! @brief RXgN^Ăяo⏕
+	//! @brief デコレータ登録
 	//-------------------------------------------------------------
-	template<typename TInterface, typename TImplementation, typename... TDeps>
-	inline void Container::registerCtor(Lifecycle cycle) {
-		std::unique_lock<std::shared_mutex> lock(mutex_);	// XbhZ[t
-		// ^nbVL[ƂĎ擾
-		const auto type = std::type_index(typeid(TInterface));
-		//o^ς݂ȂO
-		if (registrations_.find(type) != registrations_.end()) {
-			// ɓo^ς݂ȂOA㏑ꍇReplaceCtorgpB
-			throw ResolveException("Type already registered: " + std::string(type.name()));
-		}
-		// o^
-		registrations_[type] = Registration{
-			cycle,								   // CtTCN	
-			{ std::type_index(typeid(TDeps))... }, // ˑ^Xg
-			[](const std::vector<std::shared_ptr<void>>& args) {
-				return callCtorImpl<TImplementation, TDeps...>(
-					args, std::index_sequence_for<TDeps...>{});
+	template<typename TInterface, typename TDecorator, typename... TDeps>
+	inline void Container::registerDecorator() {
+		checkNotForked();
+		const auto type = typeId<TInterface>();
+		// 未読み込みのモジュールが公開している型（オープンジェネリックを含む）なら先に読み込む
+		detail::noteGeneric<TInterface>(*this);
+		loadModuleFor(type);
+		detail::noteGenerics<TDeps...>(*this);	// オープンジェネリックの依存はここで要求を記録
+		// fork したコンテナで親の登録を装飾する場合は子の上書きとして登録する
+		std::shared_ptr<const Registration> inherited;
+		if (parent_ && !findRegistration(type)) {
+			inherited = parent_->findOrLoadRegistration(type);
+		}
+		Shard& shard = shardFor(type);
+		auto lock = lockExclusive(shard, LockSite::Register); // スレッドセーフ（該当シャードのみ）
+		auto found = shard.registrations_.find(type);
+		if (found == shard.registrations_.end() && !inherited) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, type);
+		}
+		const auto base = found != shard.registrations_.end() ? found->second : inherited;
+		if (base->async_) {
+			throw ResolveException("Decorating an async factory is not supported: " + typeName(type));
+		}
+		if (base->cycle_ == Lifecycle::Pooled) {
+			// 返却時の reset フックは内側の具象型用のため、デコレータには適用できない
+			throw ResolveException("Decorating a Pooled registration is not supported, use registerDecorated: " + typeName(type));
+		}
+
+		// 依存は内側の依存の後ろにデコレータの依存を並べる（内側は先頭からそのまま参照できる）
+		std::vector<TypeId> deps = base->deps_;
+		deps.insert(deps.end(), { typeId<TDeps>()... });
+
+		// 合成したファクトリを登録（解決ごとの組み立ては行わない、デコレータの依存にもコンテキスト束縛を適用）
+		Registration decorated{
+			base->cycle_,
+			std::move(deps),
+			[inner = base->ctor_, offset = base->deps_.size()](const std::vector<std::shared_ptr<void>>& args) {
+				return callDecoratorImpl<TInterface, TDecorator, TDeps...>(
+					inner(args), args, offset, std::index_sequence_for<TDeps...>{});
 			}
 		};
-		// Singleton ̏ꍇ͌ÂCX^X
-		if (cycle == Lifecycle::Singleton) {
-			singletons_.erase(type);
+		decorated.refDeps_ = base->refDeps_;	// 内側の依存は先頭から同じ位置
+		shard.registrations_[type] = planRegistration(type, makeRegistration(std::move(decorated), nullptr, base->size_));
+		// 装飾前の Singleton / Cached を破棄（registerInstance の場合も次回解決で装飾される）
+		shard.singletons_.erase(type);
+		instance_cache_.erase(type);
+		// 検証済み状態の解除と解決キャッシュの無効化
+		markRegistrationsChanged();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 静的デコレータ付き型登録
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation, typename TDecoratorList, typename... TDeps>
+	inline void Container::registerDecorated(Lifecycle cycle) {
+		// 合成済みの型を通常のコンストラクタ登録として扱う
+		registerCtor<TInterface, Decorated<TImplementation, TDecoratorList>, TDeps...>(cycle);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief モジュール追加（登録は遅延）
+	//-------------------------------------------------------------
+	template<typename TModule>
+	inline void Container::addModule() {
+		addModuleImpl(&TModule::configure, TModule::Exports::keys());
+	}
+
+	//-------------------------------------------------------------
+	//! @brief オープンジェネリック登録
+	//-------------------------------------------------------------
+	template<template<typename...> class TInterface, template<typename...> class TImplementation>
+	inline void Container::registerGeneric(Lifecycle cycle) {
+		static_assert(GenericBinding<TInterface>::kBound, "Declare the mapping with TSUKINO_DI_GENERIC(TInterface, TImplementation) first");
+		static_assert(std::is_same<typename GenericBinding<TInterface>::template Bind<detail::GenericProbe>, TImplementation<detail::GenericProbe>>::value,
+			"TImplementation does not match the template declared with TSUKINO_DI_GENERIC");
+		registerGenericImpl(typeId<detail::GenericKey<TInterface>>(), cycle);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 消費側を限定した型登録
+	//-------------------------------------------------------------
+	template<typename TConsumer, typename TInterface, typename TImplementation>
+	inline void Container::registerContextual(Lifecycle cycle) {
+		using Ctor = detail::AutoCtor<TInterface, TImplementation>;
+		const auto key = typeId<detail::ContextualKey<TConsumer, TInterface>>();
+		if constexpr (!Ctor::hasLazy()) {
+			StaticRegistration descriptor = bindType<TInterface, TImplementation>(cycle);
+			descriptor.type_ = key;	// TInterface ではなく辺ごとのキーで登録
+			registerDescriptor(descriptor, false);
 		}
+		else {
+			Ctor::noteGenerics(*this);	// オープンジェネリックの依存はここで要求を記録
+			addRegistration(key, makeLazyRegistration<TInterface, TImplementation>(cycle), false);
+		}
+		registerContextualImpl(typeId<TConsumer>(), typeId<TInterface>(), key);
 	}
 
 	//-------------------------------------------------------------
-	//! @brief RXgN^Ăяo⏕㏑
+	//! @brief オープンジェネリックのインスタンスを登録
 	//-------------------------------------------------------------
-	template<typename TInterface, typename TImplementation, typename... TDeps>
-	inline void Container::replaceCtor(Lifecycle cycle_) {
-		std::unique_lock<std::shared_mutex> lock(mutex_);
-		const auto type = std::type_index(typeid(TInterface));
-		registrations_[type] = Registration{
-			cycle_,
-			{ std::type_index(typeid(TDeps))... },
-			[](const std::vector<std::shared_ptr<void>>& args) {
-				return callCtorImpl<TImplementation, TDeps...>(
-					args, std::index_sequence_for<TDeps...>{});
+	template<typename T>
+	inline void Container::materializeGeneric(Container& container) {
+		using Of = detail::GenericOf<T>;
+		const auto type = typeId<T>();
+		Lifecycle cycle = Lifecycle::Transient;
+		if (!container.findGeneric(Of::key(), cycle)) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, type);
+		}
+		// 個別に登録された型はそちらを優先する
+		if (container.findRegistration(type)) {
+			return;
+		}
+		try {
+			container.registerType<T, typename Of::Implementation::type>(cycle);
+		}
+		catch (const ResolveException& e) {
+			// 直前に個別登録された場合はそちらを使う
+			if (e.code() != ResolveErrorCode::AlreadyRegistered) {
+				throw;
 			}
-		};
-		//  Singleton Kj
-		singletons_.erase(type);
+		}
+	}
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief オープンジェネリック登録の対象なら要求を記録
+		//---------------------------------------------------------
+		template<typename T>
+		inline void noteGeneric(Container& container) {
+			if constexpr (GenericOf<T>::kBound) {
+				container.noteGenericUse(GenericOf<T>::key(), typeId<T>(), &Container::materializeGeneric<T>);
+			}
+			else {
+				(void)container;
+			}
+		}
 	}
 
 	//-------------------------------------------------------------
-	//! @brief CX^Xo^
+	//! @brief Pooled 型のプール上限を設定
 	//-------------------------------------------------------------
 	template<typename TInterface>
-	inline void Container::registerInstance(std::shared_ptr<TInterface> instance) {
-		std::unique_lock<std::shared_mutex> lock(mutex_); // XbhZ[t
-		// ^nbVL[ƂĎ擾
-		const auto type = std::type_index(typeid(TInterface));
-		// o^ς݊mF
-		if (registrations_.find(type) != registrations_.end()) {
-			// ɓo^ς݂ȂOA㏑ꍇReplaceInstancegpB
-			throw ResolveException("Type already registered: " + std::string(type.name()));
-		}
-		// o^
-		registrations_[type] = {
-			Lifecycle::Singleton,														// CtTCN
-			{},																			// ˑȂ
-			[instance](const std::vector<std::shared_ptr<void>>&) { return instance; }	// t@Ng֐
-		};
-		singletons_[typeid(TInterface)] = instance;  // VOgCX^XƂĕۑ
+	inline void Container::setPoolCapacity(std::size_t capacity) {
+		const auto type = typeId<TInterface>();
+		const auto reg = findOrLoadRegistration(type);
+		if (!reg) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, type);
+		}
+		if (!reg->pool_) {
+			throw ResolveException("Type is not Pooled: " + typeName(type));
+		}
+		reg->pool_->setCapacity(capacity);
 	}
 
 	//-------------------------------------------------------------
-	//! @brief CX^Xo^㏑
+	//! @brief Replicated 型のレプリカの単位を設定
 	//-------------------------------------------------------------
 	template<typename TInterface>
-	inline void Container::replaceInstance(std::shared_ptr<TInterface> instance) {
-		std::unique_lock<std::shared_mutex> lock(mutex_); // XbhZ[t
-		// ^nbVL[ƂĎ擾
-		const auto type = std::type_index(typeid(TInterface));
-		// o^
-		registrations_[type] = {
-			Lifecycle::Singleton,														// CtTCN
-			{},																			// ˑȂ
-			[instance](const std::vector<std::shared_ptr<void>>&) { return instance; }	// t@Ng֐
-		};
-		// VOgCX^XƂĕۑ
-		singletons_[type] = instance;
+	inline void Container::setReplicaGranularity(ReplicaGranularity granularity) {
+		const auto type = typeId<TInterface>();
+		const auto reg = findOrLoadRegistration(type);
+		if (!reg) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, type);
+		}
+		if (!reg->replicas_) {
+			throw ResolveException("Type is not Replicated: " + typeName(type));
+		}
+		reg->replicas_->setGranularity(granularity);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Replicated 型の全てのレプリカを一斉に更新
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	inline void Container::refreshReplicas() {
+		const auto type = typeId<TInterface>();
+		const auto reg = findOrLoadRegistration(type);
+		if (!reg) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, type);
+		}
+		if (!reg->replicas_) {
+			throw ResolveException("Type is not Replicated: " + typeName(type));
+		}
+		reg->replicas_->invalidate();
 	}
 
 	//-------------------------------------------------------------
-	//! @brief ^izˑotj
+	//! @brief 型解決（循環依存検出付き）
 	//-------------------------------------------------------------
 	template<typename TInterface>
 	inline std::shared_ptr<TInterface> Container::resolve() {
-		const auto key = std::type_index(typeid(TInterface));
-		return std::static_pointer_cast<TInterface>(resolveByKey(key));
+		const auto key = typeId<TInterface>();
+		if constexpr (detail::GenericOf<TInterface>::kBound) {
+			// オープンジェネリックの型は未登録の場合のみ要求を記録（インスタンス化後は通常の登録と同じ経路）
+			const GenericUse use{ detail::GenericOf<TInterface>::key(), &Container::materializeGeneric<TInterface> };
+			return std::static_pointer_cast<TInterface>(resolveImpl(key, nullptr, false, &use));
+		}
+		else {
+			return std::static_pointer_cast<TInterface>(resolveByKey(key));
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Transient の一括解決
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	inline std::vector<std::shared_ptr<TInterface>> Container::resolveN(std::size_t count) {
+		detail::noteGeneric<TInterface>(*this);	// オープンジェネリックの型のみ
+		std::vector<std::shared_ptr<void>> instances = resolveNByKey(typeId<TInterface>(), count);
+		std::vector<std::shared_ptr<TInterface>> result;
+		result.reserve(instances.size());
+		for (auto& instance : instances) {
+			result.push_back(std::static_pointer_cast<TInterface>(std::move(instance)));
+		}
+		return result;
 	}
 
 	//-------------------------------------------------------------
-	//! @brief ^o^ς݂mF
+	//! @brief 型解決（例外を投げない版）
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	inline ResolveResult<TInterface> Container::tryResolve() {
+		ResolveError error;
+		std::shared_ptr<void> instance;
+		if constexpr (detail::GenericOf<TInterface>::kBound) {
+			// オープンジェネリックの型は未登録の場合のみ要求を記録
+			const GenericUse use{ detail::GenericOf<TInterface>::key(), &Container::materializeGeneric<TInterface> };
+			instance = resolveImpl(typeId<TInterface>(), &error, false, &use);
+		}
+		else {
+			instance = resolveImpl(typeId<TInterface>(), &error);
+		}
+		if (error.code_ != ResolveErrorCode::None) {
+			return ResolveResult<TInterface>(error);
+		}
+		return ResolveResult<TInterface>(std::static_pointer_cast<TInterface>(instance));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型が登録済みか確認
 	//-------------------------------------------------------------
 	template<typename TInterface>
 	inline bool Container::isRegistered() const {
-		std::shared_lock<std::shared_mutex> lock(mutex_); // ǂݎpbN
-		// ^nbVL[ƂĎ擾
-		const auto type = std::type_index(typeid(TInterface));
-		// o^}bvɑ݂邩mF
-		return registrations_.find(type) != registrations_.end();
+		// オープンジェネリック登録の対象なら登録済みとみなす（fork 元を含む）
+		if constexpr (detail::GenericOf<TInterface>::kBound) {
+			for (const Container* container = this; container; container = container->parent_.get()) {
+				Lifecycle cycle;
+				if (container->findGeneric(detail::GenericOf<TInterface>::key(), cycle)) {
+					return true;
+				}
+			}
+		}
+		return isRegisteredByKey(typeId<TInterface>());
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型キーに対応するシャードを取得
+	//-------------------------------------------------------------
+	inline Container::Shard& Container::shardFor(const TypeId& key) {
+		return shards_[shardIndex(key)];
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型キーに対応するシャードを取得（const 版）
+	//-------------------------------------------------------------
+	inline const Container::Shard& Container::shardFor(const TypeId& key) const {
+		return shards_[shardIndex(key)];
+	}
+
+	//-------------------------------------------------------------
+	//! @brief シャードの書き込みロックを取得
+	//-------------------------------------------------------------
+	inline Container::ExclusiveLock Container::lockExclusive(const Shard& shard, LockSite site) const {
+#if TSUKINO_DI_LOCK_PROFILING
+		return ExclusiveLock(shard.mutex_, lock_counters_[static_cast<std::size_t>(site)]);
+#else
+		(void)site;
+		return ExclusiveLock(shard.mutex_);
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief シャードの読み取りロックを取得
+	//-------------------------------------------------------------
+	inline Container::SharedLock Container::lockShared(const Shard& shard, LockSite site) const {
+#if TSUKINO_DI_LOCK_PROFILING
+		return SharedLock(shard.mutex_, lock_counters_[static_cast<std::size_t>(site)]);
+#else
+		(void)site;
+		return SharedLock(shard.mutex_);
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型キーに対応するシャード番号を取得
+	//-------------------------------------------------------------
+	inline std::size_t Container::shardIndex(const TypeId& key) {
+		// 上位ビットを混ぜてからシャード数でマスク
+		const std::size_t h = key.hash_code();
+		return (h ^ (h >> 16)) & (kShardCount - 1);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録内容の変更を記録（検証済み状態を解除し、解決キャッシュを無効化）
+	//-------------------------------------------------------------
+	inline void Container::markRegistrationsChanged() {
+		registration_generation_.fetch_add(1, std::memory_order_acq_rel);
+		invalidateResolveCache();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 現在の登録内容が検証済みか確認
+	//-------------------------------------------------------------
+	inline bool Container::isValidated() const {
+		return validated_generation_.load(std::memory_order_acquire) == registrationGeneration();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録内容の世代を取得
+	//-------------------------------------------------------------
+	inline std::uint64_t Container::registrationGeneration() const {
+		// 親の変更でも世代が進むよう親の世代を加える（各世代は単調増加のため和も単調増加）
+		const std::uint64_t own = registration_generation_.load(std::memory_order_acquire);
+		return parent_ ? own + parent_->registrationGeneration() : own;
 	}
 }
-// ScopedContext̃ev[g֒`
+#if TSUKINO_DI_HAS_COROUTINES
+// 非同期解決（C++20 コルーチン）の実装
 namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @struct AsyncRegistration
+	//! @brief  非同期ファクトリと Singleton 共有初期化状態
+	//-------------------------------------------------------------
+	struct Container::AsyncRegistration {
+		std::function<Task<std::shared_ptr<void>>(std::vector<std::shared_ptr<void>>)> factory_;	// 非同期ファクトリ関数
+		AsyncSharedInit init_;																	// Singleton 初期化の共有状態
+	};
+
+	//-------------------------------------------------------------
+	//! @brief 非同期ファクトリ呼び出し補助
+	//! @tparam TInterface 抽象型インターフェース
+	//! @tparam TDeps      依存型リスト
+	//! @param  factory    [in] 非同期ファクトリ
+	//! @param  args       [in] 依存インスタンスリスト
+	//! @param  I          インデックスシーケンス
+	//! @return 生成されたインスタンスを返すタスク
+	//-------------------------------------------------------------
+	template<typename TInterface, typename... TDeps, typename TFactory, std::size_t... I>
+	inline Task<std::shared_ptr<void>> callAsyncFactoryImpl(
+		TFactory factory,
+		std::vector<std::shared_ptr<void>> args,
+		std::index_sequence<I...>)
+	{
+		// factory はこのフレーム内に保持されるため、キャプチャ付きでも完了まで有効
+		std::shared_ptr<TInterface> created = co_await factory(std::static_pointer_cast<TDeps>(args[I])...);
+		co_return created;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 非同期ファクトリ登録
+	//-------------------------------------------------------------
+	template<typename TInterface, typename... TDeps, typename TFactory>
+	inline void Container::registerAsyncFactory(TFactory factory, Lifecycle cycle) {
+		// 型をハッシュキーとして取得
+		const auto type = typeId<TInterface>();
+		// 非同期ファクトリを型消去して保持
+		auto async = std::make_shared<AsyncRegistration>();
+		async->factory_ = [factory](std::vector<std::shared_ptr<void>> args) {
+			return callAsyncFactoryImpl<TInterface, TDeps...>(
+				factory, std::move(args), std::index_sequence_for<TDeps...>{});
+		};
+		// 登録情報はロック外で生成（同期解決は不可）
+		detail::noteGenerics<TDeps...>(*this);	// オープンジェネリックの依存はここで要求を記録
+		auto reg = makeRegistration(Registration{
+			cycle,								   // ライフサイクル
+			{ typeId<TDeps>()... }, // 依存型リスト
+			[type](const std::vector<std::shared_ptr<void>>&) -> std::shared_ptr<void> {
+				throw ResolveException(ResolveErrorCode::AsyncOnly, type);
+			},
+			async
+		});
+		// 他の登録と同じ経路で追加（型の公開・コンテキスト束縛・解決キャッシュの無効化を含む）
+		addRegistration(type, std::move(reg), false);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 非同期型解決（循環依存検出付き）
+	//-------------------------------------------------------------
 	template<typename TInterface>
-	inline std::shared_ptr<TInterface> ScopedContext::resolve() {
-		const auto type = std::type_index(typeid(TInterface));
+	inline Task<std::shared_ptr<TInterface>> Container::resolveAsync() {
+		detail::noteGeneric<TInterface>(*this);	// オープンジェネリックの型のみ
+		std::shared_ptr<void> instance = co_await resolveAsyncByKey(typeId<TInterface>(), {});
+		co_return std::static_pointer_cast<TInterface>(instance);
+	}
 
-		// ɃXR[vɑ݂ꍇ͂Ԃ
-		auto it = scoped_instances_.find(type);
-		if (it != scoped_instances_.end()) {
-			return std::static_pointer_cast<TInterface>(it->second);
+	//-------------------------------------------------------------
+	//! @brief キーによる非同期型解決
+	//-------------------------------------------------------------
+	inline Task<std::shared_ptr<void>> Container::resolveAsyncByKey(TypeId key, std::vector<TypeId> chain) {
+		// 循環依存検出（コルーチンはスレッドを跨ぐため、スレッドローカルではなく引数の連鎖で検出）
+		// 検証済みなら循環がないことは確定しているため省略
+		if (!isValidated() && std::find(chain.begin(), chain.end(), key) != chain.end()) {
+			chain.push_back(key);
+			throw ResolveException(ResolveErrorCode::CircularDependency, std::move(chain));
 		}
 
-		// Reiɓo^Ă邩mF
-		if (!container_.isRegistered<TInterface>()) {
-			throw ResolveException("Type not registered in container: " + std::string(type.name()));
+		// 登録情報を取得（未登録ならモジュールを読み込む）
+		const auto reg = findOrLoadRegistration(key);
+		if (!reg) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, key);
 		}
 
-		// o^̃XibvVbg擾ibNtj
-		Container::Registration reg_copy;
-		{
-			std::shared_lock<std::shared_mutex> lock(container_.mutex_);
-			reg_copy = container_.registrations_.at(type);
+		// fork したコンテナでは、親の共有される寿命のインスタンスは親で解決する
+		if (parent_ && isShared(reg->cycle_) && !findRegistration(key)) {
+			auto inherited = parent_->resolveAsyncByKey(key, std::move(chain));
+			co_return co_await std::move(inherited);
 		}
 
-		// ˑċAIɉ
-		std::vector<std::shared_ptr<void>> args;
-		args.reserve(reg_copy.deps_.size());
-		for (auto& depKey : reg_copy.deps_) {
-			args.push_back(container_.resolveByKey(depKey));
+		// 既に Singleton があれば返す
+		if (reg->cycle_ == Lifecycle::Singleton) {
+			std::shared_ptr<void> existing;
+			{
+				const Shard& shard = shardFor(key);
+				auto lock = lockShared(shard, LockSite::ResolveLookup);
+				auto it = shard.singletons_.find(key);
+				if (it != shard.singletons_.end()) {
+					existing = it->second;
+				}
+			}
+			if (existing) {
+				co_return existing;
+			}
 		}
 
-		// CX^XibNOj
-		auto instance = std::static_pointer_cast<TInterface>(reg_copy.ctor_(args));
+		// 呼び出しスレッドの PerThread インスタンスがあれば返す
+		if (reg->perThread_) {
+			if (const auto* existing = reg->perThread_->get()) {
+				co_return *existing;
+			}
+		}
 
-		// XR[vɕۑ
-		scoped_instances_[type] = instance;
+		// プールに空きがあれば再利用
+		if (reg->pool_) {
+			if (auto pooled = reg->pool_->tryAcquire()) {
+				co_return pooled;
+			}
+		}
+
+		// 保持中の Cached インスタンスがあれば返す
+		if (reg->cycle_ == Lifecycle::Cached) {
+			if (auto cached = instance_cache_.get(key, reg.get())) {
+				co_return cached;
+			}
+		}
+
+		// 呼び出しスレッドのノードのレプリカがあれば返す
+		if (reg->replicas_) {
+			if (auto replica = reg->replicas_->get(reg->replicas_->generation())) {
+				co_return replica;
+			}
+		}
+
+		chain.push_back(key);
 
-		return instance;
+		// 非同期 Singleton は初期化を全待機者で共有する
+		auto* async = static_cast<AsyncRegistration*>(reg->async_.get());
+		// ※ co_await 式内の一時オブジェクトは処理系により扱いが不安定なため、名前付き変数に保持してから待つ
+		if (async && reg->cycle_ == Lifecycle::Singleton) {
+			auto start = [this, key, reg, chain]() { return constructAsync(key, reg, chain); };
+			auto shared = async->init_.await(std::move(start), async_executor_);
+			co_return co_await std::move(shared);
+		}
+		auto task = constructAsync(key, reg, std::move(chain));
+		co_return co_await std::move(task);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 依存を並行に解決してインスタンスを非同期に構築
+	//-------------------------------------------------------------
+	inline Task<std::shared_ptr<void>> Container::constructAsync(TypeId key, std::shared_ptr<const Registration> reg, std::vector<TypeId> chain) {
+		// レプリカの世代は構築前に読む（構築中に更新された場合は保持しない）
+		const std::uint64_t replicaGeneration = reg->replicas_ ? reg->replicas_->generation() : 0;
+
+		// 依存を並行に解決
+		std::vector<Task<std::shared_ptr<void>>> pending;
+		pending.reserve(reg->deps_.size());
+		for (auto& depKey : reg->deps_) {
+			pending.push_back(resolveAsyncByKey(depKey, chain));
+		}
+		std::vector<std::shared_ptr<void>> args = co_await whenAll(std::move(pending), async_executor_);
+
+		// 構築（非同期ファクトリがあれば待つ）
+		std::shared_ptr<void> created;
+		if (reg->async_) {
+			const bool timing = construction_timing_enabled_.load(std::memory_order_relaxed);
+			const auto begin = timing ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+			auto factory = static_cast<AsyncRegistration*>(reg->async_.get())->factory_(std::move(args));
+			created = co_await std::move(factory);
+			if (timing) {
+				reg->stats_->record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - begin).count()));
+			}
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+			created = detail::trackInstance(key, reg->cycle_, std::move(created), reg->size_ && created ? reg->size_(created.get()) : 0, reg->accounting_);
+#endif
+		}
+		else {
+			created = construct(key, *reg, args);
+		}
+
+		// Singleton の場合はキャッシュに保存（同期解決からも参照可能にする）
+		if (reg->cycle_ == Lifecycle::Singleton) {
+			Shard& shard = shardFor(key);
+			auto lock = lockExclusive(shard, LockSite::SingletonStore);
+			auto& slot = shard.singletons_[key];
+			if (!slot) slot = created;
+			created = slot;
+		}
+		// Pooled の場合はプール管理下に置く
+		if (reg->pool_) {
+			created = reg->pool_->adopt(std::move(created));
+		}
+		// PerThread の場合は構築を完了したスレッドに保存
+		if (reg->perThread_) {
+			reg->perThread_->set(created);
+		}
+		// Cached の場合は保持する（同期解決からも参照可能にする）
+		if (reg->cycle_ == Lifecycle::Cached) {
+			const std::size_t bytes = reg->size_ ? reg->size_(created.get()) : 0;
+			created = instance_cache_.put(key, reg.get(), std::move(created), bytes);
+		}
+		// Replicated の場合は構築を完了したスレッドのノードに保存
+		if (reg->replicas_) {
+			created = reg->replicas_->set(replicaGeneration, std::move(created));
+		}
+		co_return created;
+	}
+}
+#endif // TSUKINO_DI_HAS_COROUTINES
+// ScopedContextのテンプレートをこちらへ定義
+namespace TsukinoDIContainer {
+	template<typename TInterface>
+	inline std::shared_ptr<TInterface> ScopedContext::resolve() {
+		const auto type = typeId<TInterface>();
+		detail::TraceScope trace(container_.tracing_enabled_.load(std::memory_order_relaxed) ? &type : nullptr, ResolveTrace::Category::Scoped);
+		detail::noteGeneric<TInterface>(container_);	// オープンジェネリックの型のみ
+		return std::static_pointer_cast<TInterface>(resolveByKey(type));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief スコープ内でのみインスタンスを差し替え
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	inline void ScopedContext::override(std::shared_ptr<TInterface> instance) {
+		Override entry;
+		entry.instance_ = std::move(instance);
+		overrides_[typeId<TInterface>()] = std::move(entry);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief スコープ内でのみ実装型を差し替え
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation>
+	inline void ScopedContext::overrideType() {
+		using Ctor = detail::AutoCtor<TInterface, TImplementation>;
+		Ctor::noteGenerics(container_);	// オープンジェネリックの依存はコンテナに要求を記録
+		Override entry;
+		entry.deps_ = Ctor::deps();
+		// Lazy<T> はスコープより長く生存しうるためコンテナから解決する
+		entry.ctor_ = [container = &container_](const std::vector<std::shared_ptr<void>>& args) {
+			return Ctor::create(args, [container](const TypeId& key) { return container->resolveLazyByKey(key); });
+		};
+		overrides_[typeId<TInterface>()] = std::move(entry);
 	}
 }
\ No newline at end of file
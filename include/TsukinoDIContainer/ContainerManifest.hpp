@@ -0,0 +1,141 @@
+//-------------------------------------------------------------
+//! @file   ContainerManifest.hpp
+//! @brief  依存性注入コンテナライブラリの登録マニフェスト定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint32_t, std::uint64_t
+#include <string>     // std::string
+#include <vector>     // std::vector
+#include "Lifecycle.hpp"
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  FNV-1a ハッシュを継続計算
+		//---------------------------------------------------------
+		inline std::uint64_t fnv1a(std::uint64_t hash, const char* data, std::size_t size) {
+			for (std::size_t i = 0; i < size; ++i) {
+				hash ^= static_cast<unsigned char>(data[i]);
+				hash *= 0x100000001b3ULL;
+			}
+			return hash;
+		}
+		constexpr std::uint64_t kFnvOffset = 0xcbf29ce484222325ULL;	// FNV-1a の初期値
+	}
+
+	//-------------------------------------------------------------
+	//! @struct  ManifestEntry
+	//! @brief   マニフェストの型 1 つ分（添字が密な ID）
+	//-------------------------------------------------------------
+	struct ManifestEntry {
+		std::string key_;							// 型名（TypeId::name、同じ処理系なら実行ごとに一致）
+		std::string name_;							// 表示名
+		Lifecycle cycle_ = Lifecycle::Transient;	// ライフサイクル
+		bool registered_ = true;					// false なら依存先として参照されるだけの未登録型
+		std::vector<std::uint32_t> deps_;			// 依存先の ID
+	};
+
+	//-------------------------------------------------------------
+	//! @class   ContainerManifest
+	//! @brief   登録表のスナップショット（型・ライフサイクル・依存・トポロジカル順）
+	//! @details Container::exportManifest で取得し、toBinary / toJson で保存する。
+	//!          同じビルドの別プロセスでは fromBinary で読み込み、Container::loadManifest で
+	//!          登録内容が一致すれば validate を再実行せずに検証済みとして扱える。
+	//!          diff でビルド間の依存グラフの変化を確認できる。
+	//-------------------------------------------------------------
+	class ContainerManifest {
+	public:
+		//-------------------------------------------------------------
+		// コンストラクタ
+		//-------------------------------------------------------------
+		ContainerManifest() = default;
+
+		//-------------------------------------------------------------
+		// コンストラクタ
+		//! @param  buildHash    [in] 作成したビルドのハッシュ
+		//! @param  fingerprint  [in] 登録内容のハッシュ
+		//! @param  validated    [in] 作成時に検証済みだったか
+		//! @param  entries      [in] 型一覧（deps_ は添字で指定）
+		//! @details 依存される側が先に並ぶトポロジカル順を計算する
+		//-------------------------------------------------------------
+		ContainerManifest(std::uint64_t buildHash, std::uint64_t fingerprint, bool validated, std::vector<ManifestEntry> entries);
+
+		//-------------------------------------------------------------
+		// 現在のビルドのハッシュを取得
+		//! @return TSUKINO_DI_BUILD_ID（未定義ならライブラリのビルド日時）のハッシュ
+		//! @details ビルドシステムから TSUKINO_DI_BUILD_ID にコミット ID などを渡すことを推奨
+		//-------------------------------------------------------------
+		static std::uint64_t currentBuildHash();
+
+		//-------------------------------------------------------------
+		// バイナリ形式から読み込み
+		//! @param  data               [in] toBinary の出力
+		//! @param  expectedBuildHash  [in] 期待するビルドのハッシュ
+		//! @return 読み込んだマニフェスト
+		//! @throws ResolveException 形式が不正、またはビルドのハッシュが一致しない場合
+		//! @details ビルドのハッシュは先頭の固定長ヘッダで確認し、一致しなければ本体を読まずに拒否する
+		//-------------------------------------------------------------
+		static ContainerManifest fromBinary(const std::string& data, std::uint64_t expectedBuildHash = currentBuildHash());
+
+		//-------------------------------------------------------------
+		// バイナリ形式で出力
+		//! @return バイナリ文字列（リトルエンディアン）
+		//-------------------------------------------------------------
+		std::string toBinary() const;
+
+		//-------------------------------------------------------------
+		// JSON 形式で出力
+		//! @return JSON 文字列
+		//-------------------------------------------------------------
+		std::string toJson() const;
+
+		//-------------------------------------------------------------
+		// 別のマニフェストとの差分を取得
+		//! @param  newer  [in] 比較対象（新しい側）
+		//! @return 差分の一覧（"+ 型" 追加、"- 型" 削除、"~ 型: ..." 変更）
+		//! @details 型は表示名で対応付ける
+		//-------------------------------------------------------------
+		std::vector<std::string> diff(const ContainerManifest& newer) const;
+
+		//-------------------------------------------------------------
+		// 作成したビルドのハッシュを取得
+		//-------------------------------------------------------------
+		std::uint64_t buildHash() const { return buildHash_; }
+
+		//-------------------------------------------------------------
+		// 登録内容のハッシュを取得
+		//-------------------------------------------------------------
+		std::uint64_t fingerprint() const { return fingerprint_; }
+
+		//-------------------------------------------------------------
+		// 作成時に検証済みだったか
+		//-------------------------------------------------------------
+		bool validated() const { return validated_; }
+
+		//-------------------------------------------------------------
+		// 型一覧を取得
+		//-------------------------------------------------------------
+		const std::vector<ManifestEntry>& entries() const { return entries_; }
+
+		//-------------------------------------------------------------
+		// トポロジカル順を取得
+		//! @return 依存される側が先に並ぶ ID（循環がある場合は循環部分を末尾に並べる）
+		//-------------------------------------------------------------
+		const std::vector<std::uint32_t>& order() const { return order_; }
+
+		//-------------------------------------------------------------
+		// 循環がないか
+		//-------------------------------------------------------------
+		bool acyclic() const { return acyclic_; }
+
+	private:
+		std::uint64_t buildHash_ = 0;			// 作成したビルドのハッシュ
+		std::uint64_t fingerprint_ = 0;			// 登録内容のハッシュ
+		bool validated_ = false;				// 作成時に検証済みだったか
+		bool acyclic_ = true;					// 循環がないか
+		std::vector<ManifestEntry> entries_;	// 型一覧
+		std::vector<std::uint32_t> order_;		// トポロジカル順
+	};
+}// namespace TsukinoDIContainer
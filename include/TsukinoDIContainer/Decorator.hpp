@@ -0,0 +1,48 @@
+//-------------------------------------------------------------
+//! @file   Decorator.hpp
+//! @brief  依存性注入コンテナライブラリの静的デコレータ合成定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @struct  Decorators
+	//! @brief   静的デコレータのリスト（内側から外側の順）
+	//! @tparam  TDecorators 内側の具象型を引数に取るクラステンプレート
+	//! @details 各デコレータは template<class TInner> class X : public TInterface の形で、
+	//!          内側を TInner 型の値として保持し、コンストラクタ引数を内側へ転送する。
+	//!          内側の型が具象型のため、層の間の呼び出しは仮想呼び出しにならない。
+	//-------------------------------------------------------------
+	template<template<typename> class... TDecorators>
+	struct Decorators {};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  ComposeDecorators
+		//! @brief   具象型にデコレータを内側から順に被せた型を求める
+		//---------------------------------------------------------
+		template<typename TInner, template<typename> class... TDecorators>
+		struct ComposeDecorators {
+			using type = TInner;
+		};
+		template<typename TInner, template<typename> class TFirst, template<typename> class... TRest>
+		struct ComposeDecorators<TInner, TFirst, TRest...> {
+			using type = typename ComposeDecorators<TFirst<TInner>, TRest...>::type;
+		};
+
+		template<typename TImplementation, typename TList>
+		struct DecoratedImpl;
+		template<typename TImplementation, template<typename> class... TDecorators>
+		struct DecoratedImpl<TImplementation, Decorators<TDecorators...>> {
+			using type = typename ComposeDecorators<TImplementation, TDecorators...>::type;
+		};
+	}
+
+	//-------------------------------------------------------------
+	//! @brief   デコレータを合成した具象型
+	//! @details Decorated<Impl, Decorators<A, B>> は B<A<Impl>>
+	//-------------------------------------------------------------
+	template<typename TImplementation, typename TList>
+	using Decorated = typename detail::DecoratedImpl<TImplementation, TList>::type;
+}// namespace TsukinoDIContainer
@@ -0,0 +1,106 @@
+//-------------------------------------------------------------
+//! @file   DependencyGraph.hpp
+//! @brief  依存性注入コンテナライブラリの依存グラフ定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <string>     // std::string
+#include <vector>     // std::vector
+#include "TypeId.hpp" // TypeId
+#include "Lifecycle.hpp"
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @struct  GraphNode
+	//! @brief   依存グラフのノード（登録済みの型 1 つ）
+	//-------------------------------------------------------------
+	struct GraphNode {
+		TypeId type_;		// 型
+		std::string name_;							// 表示名
+		Lifecycle cycle_ = Lifecycle::Transient;	// ライフサイクル
+		bool registered_ = true;					// false なら依存先として参照されるだけの未登録型
+		std::vector<std::size_t> deps_;				// 依存先ノードの添字
+		std::size_t fanIn_ = 0;						// このノードに依存するノード数
+		std::size_t fanOut_ = 0;					// このノードが依存するノード数
+		std::uint64_t constructCount_ = 0;			// 計測された構築回数
+		std::uint64_t totalConstructNanos_ = 0;		// 計測された構築時間の合計（依存の解決は含まない）
+		std::uint64_t maxConstructNanos_ = 0;		// 計測された構築時間の最大値
+		std::size_t level_ = 0;						// トポロジカルレベル（依存なしが 0）
+
+		//---------------------------------------------------------
+		// 平均構築時間を取得
+		//! @return 平均構築時間（ナノ秒、未計測なら 0）
+		//---------------------------------------------------------
+		std::uint64_t averageConstructNanos() const {
+			return constructCount_ ? totalConstructNanos_ / constructCount_ : 0;
+		}
+	};
+
+	//-------------------------------------------------------------
+	//! @class   DependencyGraph
+	//! @brief   登録済みの依存グラフと起動時間の解析結果
+	//! @details Container::exportGraph で取得する。ノードの重みは平均構築時間で、
+	//!          クリティカルパスは依存を辿って重みの合計が最大となる経路。
+	//!          並列幅は同じトポロジカルレベルに並ぶノード数の最大値で、
+	//!          依存が揃った型から並行に構築した場合に同時に構築できる型数の目安。
+	//-------------------------------------------------------------
+	class DependencyGraph {
+	public:
+		//-------------------------------------------------------------
+		// コンストラクタ
+		//! @param  nodes  [in] ノード一覧（deps_ は添字で指定）
+		//! @details 入次数・出次数・レベル・クリティカルパス・並列幅を計算する。
+		//!          循環がある場合は循環を構成する辺を無視して計算する。
+		//-------------------------------------------------------------
+		explicit DependencyGraph(std::vector<GraphNode> nodes);
+
+		//-------------------------------------------------------------
+		// ノード一覧を取得
+		//! @return ノード一覧
+		//-------------------------------------------------------------
+		const std::vector<GraphNode>& nodes() const { return nodes_; }
+
+		//-------------------------------------------------------------
+		// クリティカルパスを取得
+		//! @return 依存する側から依存される側の順に並んだノード添字
+		//-------------------------------------------------------------
+		const std::vector<std::size_t>& criticalPath() const { return criticalPath_; }
+
+		//-------------------------------------------------------------
+		// クリティカルパスの合計構築時間を取得
+		//! @return 合計構築時間（ナノ秒）
+		//-------------------------------------------------------------
+		std::uint64_t criticalPathNanos() const { return criticalPathNanos_; }
+
+		//-------------------------------------------------------------
+		// 並列幅を取得
+		//! @return 同一レベルに並ぶノード数の最大値
+		//-------------------------------------------------------------
+		std::size_t parallelWidth() const { return parallelWidth_; }
+
+		//-------------------------------------------------------------
+		// Graphviz DOT 形式で出力
+		//! @return DOT 文字列（クリティカルパスは赤で強調）
+		//-------------------------------------------------------------
+		std::string toDot() const;
+
+		//-------------------------------------------------------------
+		// JSON 形式で出力
+		//! @return JSON 文字列
+		//-------------------------------------------------------------
+		std::string toJson() const;
+
+	private:
+		//-------------------------------------------------------------
+		// 次数・レベル・クリティカルパス・並列幅を計算
+		//-------------------------------------------------------------
+		void analyze();
+
+		std::vector<GraphNode> nodes_;				// ノード一覧
+		std::vector<std::size_t> criticalPath_;		// クリティカルパス
+		std::uint64_t criticalPathNanos_ = 0;		// クリティカルパスの合計構築時間
+		std::size_t parallelWidth_ = 0;				// 並列幅
+	};
+}// namespace TsukinoDIContainer
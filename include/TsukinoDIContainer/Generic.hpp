@@ -0,0 +1,102 @@
+//-------------------------------------------------------------
+//! @file   Generic.hpp
+//! @brief  依存性注入コンテナライブラリのオープンジェネリック登録定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include "TypeId.hpp" // TypeId
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	class Container;
+
+	//-------------------------------------------------------------
+	//! @struct  GenericBinding
+	//! @brief   インターフェースのテンプレートに対応する実装のテンプレート
+	//! @tparam  TInterface  インターフェースのテンプレート（例: IRepository）
+	//! @details TSUKINO_DI_GENERIC で特殊化する。特殊化されていないテンプレートは対象外。
+	//-------------------------------------------------------------
+	template<template<typename...> class TInterface>
+	struct GenericBinding {
+		static constexpr bool kBound = false;	// 実装のテンプレートが対応付けられているか
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  GenericKey
+		//! @brief   インターフェースのテンプレートを TypeId で識別するためのタグ
+		//---------------------------------------------------------
+		template<template<typename...> class TInterface>
+		struct GenericKey {};
+
+		//---------------------------------------------------------
+		//! @struct  GenericProbe
+		//! @brief   registerGeneric で対応付けを確認するための引数型（実体化はしない）
+		//---------------------------------------------------------
+		struct GenericProbe;
+
+		//---------------------------------------------------------
+		//! @struct  GenericOf
+		//! @brief   型がオープンジェネリック登録の対象となるインスタンスか
+		//! @details TInterface<TArgs...> の形で、TInterface が TSUKINO_DI_GENERIC で対応付けられていれば対象
+		//---------------------------------------------------------
+		template<typename T>
+		struct GenericOf {
+			static constexpr bool kBound = false;
+		};
+		template<template<typename...> class TInterface, typename... TArgs>
+		struct GenericOf<TInterface<TArgs...>> {
+			static constexpr bool kBound = GenericBinding<TInterface>::kBound;
+			//! @brief インターフェースのテンプレートの識別子
+			static TypeId key() { return typeId<GenericKey<TInterface>>(); }
+			//! @brief 対応する実装型（参照した時点で実体化）
+			struct Implementation {
+				using type = typename GenericBinding<TInterface>::template Bind<TArgs...>;
+			};
+		};
+
+		//---------------------------------------------------------
+		// オープンジェネリック登録の対象なら、初回の解決時に登録されるよう記録する
+		//! @tparam T  依存型（対象外の型なら何もしない）
+		//! @param  container  [in] 記録先のコンテナ
+		//! @details Container.hpp で定義する
+		//---------------------------------------------------------
+		template<typename T>
+		void noteGeneric(Container& container);
+
+		//---------------------------------------------------------
+		//! @brief  依存型リストをまとめて記録
+		//---------------------------------------------------------
+		template<typename... T>
+		void noteGenerics(Container& container) {
+			(void)container;
+			(noteGeneric<T>(container), ...);
+		}
+		using NoteGenericsFn = void(*)(Container&);	// 依存型リストの記録関数
+
+		//---------------------------------------------------------
+		//! @brief  依存型リストの記録関数（対象の型がなければ nullptr、型ごとの関数を生成しない）
+		//---------------------------------------------------------
+		template<typename... T>
+		constexpr NoteGenericsFn noteGenericsFn() {
+			if constexpr ((false || ... || GenericOf<T>::kBound)) {
+				return &noteGenerics<T...>;
+			}
+			else {
+				return nullptr;
+			}
+		}
+	}
+}// namespace TsukinoDIContainer
+
+//-------------------------------------------------------------
+// インターフェースのテンプレートに実装のテンプレートを対応付ける（グローバル名前空間で使用）
+//! @param  TInterface       インターフェースのテンプレート（名前空間を含めて指定）
+//! @param  TImplementation  実装のテンプレート（同じ引数を受け取ること）
+//! @details Container::registerGeneric<TInterface, TImplementation>() を呼んだコンテナで、
+//!          TInterface<X> が初めて要求された時点で TImplementation<X> が registerType される。
+//-------------------------------------------------------------
+#define TSUKINO_DI_GENERIC(TInterface, TImplementation)                              \
+	template<> struct TsukinoDIContainer::GenericBinding<TInterface> {               \
+		static constexpr bool kBound = true;                                         \
+		template<typename... TArgs> using Bind = TImplementation<TArgs...>;          \
+	}
@@ -0,0 +1,123 @@
+//-------------------------------------------------------------
+//! @file   InstanceAccounting.hpp
+//! @brief  依存性注入コンテナライブラリのインスタンス計上定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <atomic>         // std::atomic
+#include <cstddef>        // std::size_t
+#include <cstdint>        // std::uint64_t
+#include <memory>         // std::shared_ptr
+#include <string>         // std::string
+#include "TypeId.hpp"     // TypeId
+#include <unordered_map>  // std::unordered_map
+#include <vector>         // std::vector
+#include "Lifecycle.hpp"  // Lifecycle
+// インスタンス計上を有効にする場合は 1 を定義（全ての翻訳単位で同じ値にすること）
+// 無効時は構築したインスタンスをそのまま返す（包まない）
+#ifndef TSUKINO_DI_INSTANCE_ACCOUNTING
+#define TSUKINO_DI_INSTANCE_ACCOUNTING 0
+#endif
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @struct  TypeAccounting
+	//! @brief   型 1 つ分のインスタンス計上値
+	//-------------------------------------------------------------
+	struct TypeAccounting {
+		TypeId type_;	// 型
+		std::uint64_t constructed_ = 0;			// 構築した数（累計）
+		std::uint64_t live_ = 0;				// 破棄されていない数
+		std::uint64_t peakLive_ = 0;			// 破棄されていない数の最大値
+		std::size_t liveBytes_ = 0;				// 破棄されていないインスタンスの合計サイズ（概算）
+		std::size_t peakBytes_ = 0;				// 合計サイズの最大値
+	};
+
+	//-------------------------------------------------------------
+	//! @struct  InstanceAccounting
+	//! @brief   Container::instanceAccounting / ScopedContext::instanceAccounting の計上結果
+	//-------------------------------------------------------------
+	struct InstanceAccounting {
+		bool enabled_ = false;				// TSUKINO_DI_INSTANCE_ACCOUNTING が有効なビルドか
+		std::vector<TypeAccounting> types_;	// 型ごとの計上値（破棄されていないサイズの大きい順、無効時は空）
+
+		//---------------------------------------------------------
+		// 型ごとに 1 行ずつ並べた文字列を取得
+		//! @return 計上結果の表形式の文字列
+		//---------------------------------------------------------
+		std::string toString() const;
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  AccountingCounters
+		//! @brief   型 1 つ分の計上値（型ごとにキャッシュラインを分ける）
+		//---------------------------------------------------------
+		struct alignas(64) AccountingCounters {
+			std::atomic<std::uint64_t> constructed_{ 0 };
+			std::atomic<std::uint64_t> live_{ 0 };
+			std::atomic<std::uint64_t> peakLive_{ 0 };
+			std::atomic<std::size_t> liveBytes_{ 0 };
+			std::atomic<std::size_t> peakBytes_{ 0 };
+
+			//! @brief 構築を記録
+			void onConstruct(std::size_t bytes);
+			//! @brief 破棄を記録
+			void onDestroy(std::size_t bytes) noexcept;
+			//! @brief 計上値を取得
+			TypeAccounting snapshot(const TypeId& type) const;
+		};
+
+		//---------------------------------------------------------
+		//! @struct  ScopeAccounting
+		//! @brief   ScopedContext 1 つ分の型ごとの計上値
+		//! @details スコープのスレッドからのみ追加する（計上値自体は破棄したスレッドから更新される）
+		//---------------------------------------------------------
+		struct ScopeAccounting {
+			std::unordered_map<TypeId, std::shared_ptr<AccountingCounters>> types_;	// 型 → 計上値
+		};
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドで解決中のスコープの計上先を取得
+		//! @return 計上先への参照（スコープ外なら nullptr）
+		//---------------------------------------------------------
+		ScopeAccounting*& currentScopeAccounting() noexcept;
+
+		//---------------------------------------------------------
+		//! @class   ScopeAccountingGuard
+		//! @brief   スコープ経由の解決中に計上先を設定する RAII
+		//---------------------------------------------------------
+		class ScopeAccountingGuard {
+		public:
+			explicit ScopeAccountingGuard(ScopeAccounting& scope) noexcept
+				: previous_(currentScopeAccounting()) {
+				currentScopeAccounting() = &scope;
+			}
+			~ScopeAccountingGuard() { currentScopeAccounting() = previous_; }
+			ScopeAccountingGuard(const ScopeAccountingGuard&) = delete;
+			ScopeAccountingGuard& operator=(const ScopeAccountingGuard&) = delete;
+
+		private:
+			ScopeAccounting* previous_;	// 入れ子のスコープの計上先
+		};
+
+		//---------------------------------------------------------
+		// 構築したインスタンスを計上し、破棄時に減算するよう包む
+		//! @param  type      [in] 型のキー
+		//! @param  cycle     [in] ライフサイクル（共有される寿命の型はスコープに計上しない）
+		//! @param  instance  [in] 構築したインスタンス
+		//! @param  bytes     [in] インスタンスのサイズ（概算）
+		//! @param  counters  [in] 登録の計上値
+		//! @return 包んだインスタンス（同じアドレスを指す）
+		//---------------------------------------------------------
+		std::shared_ptr<void> trackInstance(const TypeId& type, Lifecycle cycle, std::shared_ptr<void> instance,
+			std::size_t bytes, const std::shared_ptr<AccountingCounters>& counters);
+
+		//---------------------------------------------------------
+		// 計上値の一覧を並べ替えて結果を生成
+		//! @param  types  [in] 型ごとの計上値
+		//! @return 計上結果
+		//---------------------------------------------------------
+		InstanceAccounting makeInstanceAccounting(std::vector<TypeAccounting> types);
+	}
+}// namespace TsukinoDIContainer
@@ -0,0 +1,149 @@
+//-------------------------------------------------------------
+//! @file   InstanceCache.hpp
+//! @brief  依存性注入コンテナライブラリの Cached ライフサイクル用キャッシュ定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <chrono>       // std::chrono::steady_clock
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <list>         // std::list
+#include <memory>       // std::shared_ptr
+#include <mutex>        // std::mutex
+#include <type_traits>  // std::void_t
+#include "TypeId.hpp"   // TypeId
+#include <unordered_map> // std::unordered_map
+#include <utility>      // std::declval
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @struct  CachePolicy
+	//! @brief   Cached ライフサイクルの保持方針（コンテナ全体で 1 つ）
+	//-------------------------------------------------------------
+	struct CachePolicy {
+		std::chrono::steady_clock::duration ttl_{ 0 };	// 構築からの保持期間（0 なら期限なし）
+		std::size_t byteBudget_ = 0;					// 保持するインスタンスの合計サイズの上限（0 なら上限なし）
+	};
+
+	//-------------------------------------------------------------
+	//! @struct  CacheStats
+	//! @brief   Container::cacheStats の集計値
+	//-------------------------------------------------------------
+	struct CacheStats {
+		std::uint64_t hits_ = 0;		// 保持中のインスタンスを返した回数
+		std::uint64_t misses_ = 0;		// 保持していなかったため構築した回数
+		std::uint64_t evictions_ = 0;	// 上限を超えたため LRU で破棄した回数
+		std::uint64_t expirations_ = 0;	// 保持期間を過ぎたため破棄した回数
+		std::size_t entries_ = 0;		// 保持中のインスタンス数
+		std::size_t bytes_ = 0;			// 保持中のインスタンスの合計サイズ
+	};
+
+	//-------------------------------------------------------------
+	//! @class   InstanceCache
+	//! @brief   Cached ライフサイクルのインスタンスを保持期間・合計サイズの上限付きで保持する
+	//! @details 型ごとに 1 インスタンスを保持し、上限を超えた場合は最も長く参照されていない型から破棄する。
+	//!          破棄はコンテナの参照を手放すだけで、解決済みのインスタンスは利用者が保持している間は有効。
+	//!          エントリは登録情報ごとに区別するため、replace 前の登録で構築したインスタンスは返さない。
+	//-------------------------------------------------------------
+	class InstanceCache {
+	public:
+		using SizeFn = std::size_t(*)(const void*);	// インスタンスのサイズ取得（型消去）
+
+		//---------------------------------------------------------
+		// 保持中のインスタンスを取得
+		//! @param  key    [in] 型のキー（TypeId）
+		//! @param  owner  [in] 登録情報（構築時と異なれば無効）
+		//! @return インスタンス（保持していない、または期限切れなら nullptr）
+		//---------------------------------------------------------
+		std::shared_ptr<void> get(const TypeId& key, const void* owner);
+
+		//---------------------------------------------------------
+		// 構築したインスタンスを保持
+		//! @param  key       [in] 型のキー（TypeId）
+		//! @param  owner     [in] 登録情報
+		//! @param  instance  [in] 構築したインスタンス
+		//! @param  bytes     [in] インスタンスのサイズ
+		//! @return 保持しているインスタンス（他スレッドが先に保持していればそちら）
+		//! @details 上限を超えた場合、返すインスタンス自身も保持せずに破棄されることがある
+		//---------------------------------------------------------
+		std::shared_ptr<void> put(const TypeId& key, const void* owner, std::shared_ptr<void> instance, std::size_t bytes);
+
+		//---------------------------------------------------------
+		// 型のインスタンスを破棄
+		//! @param  key  [in] 型のキー（TypeId）
+		//---------------------------------------------------------
+		void erase(const TypeId& key);
+
+		//---------------------------------------------------------
+		// 全てのインスタンスを破棄
+		//---------------------------------------------------------
+		void clear();
+
+		//---------------------------------------------------------
+		// 保持方針を設定（上限を超えている分は即座に破棄）
+		//! @param  policy  [in] 保持方針
+		//---------------------------------------------------------
+		void setPolicy(const CachePolicy& policy);
+
+		//---------------------------------------------------------
+		// 集計値を取得
+		//! @return 集計値
+		//---------------------------------------------------------
+		CacheStats stats() const;
+
+	private:
+		//---------------------------------------------------------
+		//! @struct  Entry
+		//! @brief   保持中のインスタンス 1 つ
+		//---------------------------------------------------------
+		struct Entry {
+			TypeId key_;								// 型のキー
+			const void* owner_;									// 構築した登録情報
+			std::shared_ptr<void> instance_;					// インスタンス
+			std::size_t bytes_;									// サイズ
+			std::chrono::steady_clock::time_point expires_;		// 期限（期限なしなら time_point::max）
+		};
+		using EntryList = std::list<Entry>;
+
+		//---------------------------------------------------------
+		// 期限切れと上限超過の分を取り出す（ロック中に呼ぶ、破棄はロック外で行う）
+		//! @param  now      [in]  現在時刻
+		//! @param  removed  [out] 取り出したエントリ
+		//---------------------------------------------------------
+		void trim(std::chrono::steady_clock::time_point now, EntryList& removed);
+
+		//---------------------------------------------------------
+		// エントリを取り出す（ロック中に呼ぶ）
+		//---------------------------------------------------------
+		void unlink(EntryList::iterator it, EntryList& removed);
+
+		mutable std::mutex mutex_;											// 全メンバ保護用
+		EntryList lru_;														// 参照順（先頭ほど最近）
+		std::unordered_map<TypeId, EntryList::iterator> index_;	// 型 → エントリ
+		CachePolicy policy_;												// 保持方針
+		CacheStats stats_;													// 集計値
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  Cached のインスタンスのサイズ取得フックを取得
+		//! @details 具象型が cacheSize() を持てばその値（内部で確保した領域を含めた見積もり）、
+		//!          なければ sizeof(TImplementation) を使う。
+		//!          保持するポインタは抽象型を指すため、抽象型を経由して具象型へ戻す。
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename = void>
+		struct SizeHook {
+			static constexpr InstanceCache::SizeFn get() {
+				return [](const void*) -> std::size_t { return sizeof(TImplementation); };
+			}
+		};
+		template<typename TInterface, typename TImplementation>
+		struct SizeHook<TInterface, TImplementation, std::void_t<decltype(std::declval<const TImplementation&>().cacheSize())>> {
+			static constexpr InstanceCache::SizeFn get() {
+				return [](const void* object) -> std::size_t {
+					return static_cast<std::size_t>(static_cast<const TImplementation*>(static_cast<const TInterface*>(object))->cacheSize());
+				};
+			}
+		};
+	}
+}// namespace TsukinoDIContainer
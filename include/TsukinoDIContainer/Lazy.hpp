@@ -0,0 +1,73 @@
+//-------------------------------------------------------------
+//! @file   Lazy.hpp
+//! @brief  依存性注入コンテナライブラリの遅延解決ハンドル定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <atomic>      // std::atomic
+#include <functional>  // std::function
+#include <memory>      // std::shared_ptr
+#include <mutex>       // std::mutex
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @class   Lazy
+	//! @brief   初回参照時に解決する依存
+	//! @tparam  T  抽象型インターフェース
+	//! @details registerType の自動注入でコンストラクタ引数に Lazy<T> を書くと、
+	//!          構築時には解決せず、初めて get() した時点でコンテナから解決する。
+	//!          解決結果はハンドルのコピー間で共有される（スレッドセーフ）。
+	//!          依存グラフの辺にはならないため、循環する依存の片側を遅らせる用途にも使える。
+	//!          コンテナより長く保持しないこと。
+	//-------------------------------------------------------------
+	template<typename T>
+	class Lazy {
+	public:
+		using Resolver = std::function<std::shared_ptr<void>()>;	// 解決関数
+
+		//---------------------------------------------------------
+		// コンストラクタ
+		//! @param  resolver  [in] 解決関数（初回の get() で 1 回だけ呼ばれる）
+		//---------------------------------------------------------
+		explicit Lazy(Resolver resolver)
+			: state_(std::make_shared<State>(std::move(resolver))) {
+		}
+
+		//---------------------------------------------------------
+		// インスタンスを取得（初回のみ解決）
+		//! @return 解決されたインスタンス
+		//! @throws ResolveException 解決に失敗した場合（次回の get() で再試行する）
+		//---------------------------------------------------------
+		const std::shared_ptr<T>& get() const {
+			State& state = *state_;
+			if (!state.ready_.load(std::memory_order_acquire)) {
+				std::lock_guard<std::mutex> lock(state.mutex_);
+				if (!state.ready_.load(std::memory_order_relaxed)) {
+					state.instance_ = std::static_pointer_cast<T>(state.resolver_());
+					state.ready_.store(true, std::memory_order_release);
+				}
+			}
+			return state.instance_;
+		}
+
+		//---------------------------------------------------------
+		// メンバアクセス
+		//---------------------------------------------------------
+		T* operator->() const { return get().get(); }
+		T& operator*() const { return *get(); }
+
+	private:
+		//---------------------------------------------------------
+		//! @struct  State
+		//! @brief   コピー間で共有する解決状態
+		//---------------------------------------------------------
+		struct State {
+			explicit State(Resolver resolver) : resolver_(std::move(resolver)) {}
+			Resolver resolver_;					// 解決関数
+			std::mutex mutex_;					// 初回解決の排他
+			std::atomic<bool> ready_{ false };	// 解決済みフラグ
+			std::shared_ptr<T> instance_;		// 解決されたインスタンス
+		};
+		std::shared_ptr<State> state_;	// 共有する解決状態
+	};
+}// namespace TsukinoDIContainer
@@ -1,19 +1,50 @@
 //-------------------------------------------------------------
 //! @file   Lifecycle.hpp
-//! @brief  ˑReiCũCtTCN`
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリのライフサイクル定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
-// O : TsukinoDIContainer
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer
 {
 	//-------------------------------------------------------------
 	//! @enum   Lifecycle
-	//! @brief  CX^X̃CtTCNǗ@
+	//! @brief  インスタンスのライフサイクル管理方法
 	//-------------------------------------------------------------
 	enum class Lifecycle {
-		Transient,  //!< VCX^X
-		Singleton,  //!< ŜŋL
-		Scoped      //!< XR[vƂɋL
+		Transient,  //!< 毎回新しいインスタンス
+		Singleton,  //!< 全体で共有
+		Scoped,     //!< スコープごとに共有
+		Pooled,     //!< 解放時にプールへ戻して再利用
+		PerThread,  //!< スレッドごとに共有
+		Cached,     //!< 保持期間・合計サイズの上限内で共有（破棄後は次の解決で再構築）
+		Replicated  //!< NUMA ノード（または CPU）ごとに共有
 	};
+
+	//-------------------------------------------------------------
+	// ライフサイクルの名前を取得
+	//! @param  cycle  [in] ライフサイクル
+	//! @return 列挙子名の文字列
+	//-------------------------------------------------------------
+	inline const char* toString(Lifecycle cycle) {
+		switch (cycle) {
+		case Lifecycle::Transient: return "Transient";
+		case Lifecycle::Singleton: return "Singleton";
+		case Lifecycle::Scoped:    return "Scoped";
+		case Lifecycle::Pooled:    return "Pooled";
+		case Lifecycle::PerThread: return "PerThread";
+		case Lifecycle::Cached:    return "Cached";
+		case Lifecycle::Replicated: return "Replicated";
+		}
+		return "Unknown";
+	}
+
+	//-------------------------------------------------------------
+	// インスタンスをコンテナ内で共有するライフサイクルか
+	//! @param  cycle  [in] ライフサイクル
+	//! @return 解決ごと・スコープごとに構築しない（Singleton / Pooled / PerThread / Cached / Replicated）なら true
+	//-------------------------------------------------------------
+	inline bool isShared(Lifecycle cycle) {
+		return cycle != Lifecycle::Transient && cycle != Lifecycle::Scoped;
+	}
 }
\ No newline at end of file
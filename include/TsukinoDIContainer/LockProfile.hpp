@@ -0,0 +1,197 @@
+//-------------------------------------------------------------
+//! @file   LockProfile.hpp
+//! @brief  依存性注入コンテナライブラリのロック計測定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <array>      // std::array
+#include <atomic>     // std::atomic
+#include <chrono>     // std::chrono::steady_clock
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <mutex>      // std::try_to_lock
+#include <string>     // std::string
+#include <utility>    // std::move
+#include <vector>     // std::vector
+// ロック計測を有効にする場合は 1 を定義（全ての翻訳単位で同じ値にすること）
+// 無効時はシャードのロックは素の std::unique_lock / std::shared_lock となる
+#ifndef TSUKINO_DI_LOCK_PROFILING
+#define TSUKINO_DI_LOCK_PROFILING 0
+#endif
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @enum   LockSite
+	//! @brief  シャードのロックを取得する呼び出し箇所
+	//-------------------------------------------------------------
+	enum class LockSite : std::uint8_t {
+		Register,		//!< register / replace 系（一括登録を含む）
+		ResolveLookup,	//!< 解決時の登録確認・登録情報スナップショット・既存 Singleton 確認（1 回のロック）
+		SingletonStore,	//!< 構築した Singleton の保存
+		IsRegistered,	//!< isRegistered
+		Snapshot		//!< 登録情報の単体検索、validate / exportGraph などの全体スナップショット
+	};
+	constexpr std::size_t kLockSiteCount = 5;	// LockSite の数
+
+	//-------------------------------------------------------------
+	// LockSite を文字列に変換
+	//! @param  site  [in] 呼び出し箇所
+	//! @return 名前
+	//-------------------------------------------------------------
+	inline const char* toString(LockSite site) {
+		switch (site) {
+		case LockSite::Register:       return "Register";
+		case LockSite::ResolveLookup:  return "ResolveLookup";
+		case LockSite::SingletonStore: return "SingletonStore";
+		case LockSite::IsRegistered:   return "IsRegistered";
+		case LockSite::Snapshot:       return "Snapshot";
+		}
+		return "Unknown";
+	}
+
+	//-------------------------------------------------------------
+	//! @struct  LockSiteStats
+	//! @brief   呼び出し箇所 1 つ分のロック計測値
+	//-------------------------------------------------------------
+	struct LockSiteStats {
+		LockSite site_ = LockSite::Register;	// 呼び出し箇所
+		std::uint64_t acquisitions_ = 0;		// 取得回数
+		std::uint64_t contended_ = 0;			// 即座に取得できなかった回数
+		std::uint64_t waitNanos_ = 0;			// 待ち時間の合計（競合時のみ計測）
+		std::uint64_t maxWaitNanos_ = 0;		// 待ち時間の最大値
+		std::uint64_t holdNanos_ = 0;			// 保持時間の合計
+		std::uint64_t maxHoldNanos_ = 0;		// 保持時間の最大値
+		std::uint64_t maxWaiters_ = 0;			// 同時に待っていたスレッド数の最大値
+	};
+
+	//-------------------------------------------------------------
+	//! @struct  LockProfile
+	//! @brief   Container::lockProfile の計測結果
+	//-------------------------------------------------------------
+	struct LockProfile {
+		bool enabled_ = false;				// TSUKINO_DI_LOCK_PROFILING が有効なビルドか
+		std::vector<LockSiteStats> sites_;	// 呼び出し箇所ごとの計測値（無効時は空）
+
+		//---------------------------------------------------------
+		// 呼び出し箇所ごとに 1 行ずつ並べた文字列を取得
+		//! @return 計測結果の表形式の文字列
+		//---------------------------------------------------------
+		std::string toString() const;
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  LockSiteCounters
+		//! @brief   呼び出し箇所 1 つ分の集計値（箇所ごとにキャッシュラインを分ける）
+		//---------------------------------------------------------
+		struct alignas(64) LockSiteCounters {
+			std::atomic<std::uint64_t> acquisitions_{ 0 };
+			std::atomic<std::uint64_t> contended_{ 0 };
+			std::atomic<std::uint64_t> waitNanos_{ 0 };
+			std::atomic<std::uint64_t> maxWaitNanos_{ 0 };
+			std::atomic<std::uint64_t> holdNanos_{ 0 };
+			std::atomic<std::uint64_t> maxHoldNanos_{ 0 };
+			std::atomic<std::uint64_t> waiting_{ 0 };		// 現在待っているスレッド数
+			std::atomic<std::uint64_t> maxWaiters_{ 0 };
+
+			//! @brief 最大値を更新
+			static void updateMax(std::atomic<std::uint64_t>& target, std::uint64_t value) {
+				std::uint64_t prev = target.load(std::memory_order_relaxed);
+				while (prev < value && !target.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {}
+			}
+			//! @brief 経過時間（ナノ秒）
+			static std::uint64_t elapsed(std::chrono::steady_clock::time_point begin) {
+				return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now() - begin).count());
+			}
+			//! @brief 保持時間を記録
+			void recordHold(std::uint64_t nanos) {
+				holdNanos_.fetch_add(nanos, std::memory_order_relaxed);
+				updateMax(maxHoldNanos_, nanos);
+			}
+			//! @brief 集計値を取得
+			LockSiteStats snapshot(LockSite site) const {
+				LockSiteStats stats;
+				stats.site_ = site;
+				stats.acquisitions_ = acquisitions_.load(std::memory_order_relaxed);
+				stats.contended_ = contended_.load(std::memory_order_relaxed);
+				stats.waitNanos_ = waitNanos_.load(std::memory_order_relaxed);
+				stats.maxWaitNanos_ = maxWaitNanos_.load(std::memory_order_relaxed);
+				stats.holdNanos_ = holdNanos_.load(std::memory_order_relaxed);
+				stats.maxHoldNanos_ = maxHoldNanos_.load(std::memory_order_relaxed);
+				stats.maxWaiters_ = maxWaiters_.load(std::memory_order_relaxed);
+				return stats;
+			}
+			//! @brief 集計値を 0 に戻す（待機中のスレッド数は残す）
+			void reset() {
+				for (auto* counter : { &acquisitions_, &contended_, &waitNanos_, &maxWaitNanos_, &holdNanos_, &maxHoldNanos_, &maxWaiters_ }) {
+					counter->store(0, std::memory_order_relaxed);
+				}
+			}
+		};
+
+		//---------------------------------------------------------
+		//! @class   ProfiledLock
+		//! @brief   待ち時間・保持時間を記録するロック
+		//! @tparam  TLock  std::unique_lock / std::shared_lock
+		//! @details まず try_to_lock で取得を試み、失敗した場合のみ待ち時間を計測する。
+		//!          unique_lock / shared_lock と同じ使い方（unlock / owns_lock / ムーブ）ができる。
+		//---------------------------------------------------------
+		template<typename TLock>
+		class ProfiledLock {
+		public:
+			using mutex_type = typename TLock::mutex_type;
+
+			ProfiledLock() = default;
+			ProfiledLock(mutex_type& mutex, LockSiteCounters& counters)
+				: lock_(mutex, std::try_to_lock), counters_(&counters) {
+				if (!lock_.owns_lock()) {
+					counters.contended_.fetch_add(1, std::memory_order_relaxed);
+					LockSiteCounters::updateMax(counters.maxWaiters_, counters.waiting_.fetch_add(1, std::memory_order_relaxed) + 1);
+					const auto begin = std::chrono::steady_clock::now();
+					lock_.lock();
+					const auto wait = LockSiteCounters::elapsed(begin);
+					counters.waiting_.fetch_sub(1, std::memory_order_relaxed);
+					counters.waitNanos_.fetch_add(wait, std::memory_order_relaxed);
+					LockSiteCounters::updateMax(counters.maxWaitNanos_, wait);
+				}
+				counters.acquisitions_.fetch_add(1, std::memory_order_relaxed);
+				acquired_ = std::chrono::steady_clock::now();
+			}
+			ProfiledLock(ProfiledLock&& other) noexcept
+				: lock_(std::move(other.lock_)), counters_(other.counters_), acquired_(other.acquired_) {
+				other.counters_ = nullptr;
+			}
+			ProfiledLock& operator=(ProfiledLock&& other) noexcept {
+				if (this != &other) {
+					if (owns_lock()) unlock();
+					lock_ = std::move(other.lock_);
+					counters_ = other.counters_;
+					acquired_ = other.acquired_;
+					other.counters_ = nullptr;
+				}
+				return *this;
+			}
+			ProfiledLock(const ProfiledLock&) = delete;
+			ProfiledLock& operator=(const ProfiledLock&) = delete;
+			~ProfiledLock() {
+				if (owns_lock()) unlock();
+			}
+
+			//! @brief 保持時間を記録して解放
+			void unlock() {
+				if (counters_) {
+					counters_->recordHold(LockSiteCounters::elapsed(acquired_));
+				}
+				lock_.unlock();
+			}
+			//! @brief ロックを保持しているか
+			bool owns_lock() const noexcept { return lock_.owns_lock(); }
+
+		private:
+			TLock lock_;									// 実際のロック
+			LockSiteCounters* counters_ = nullptr;			// 記録先
+			std::chrono::steady_clock::time_point acquired_;	// 取得した時刻
+		};
+	}
+}// namespace TsukinoDIContainer
@@ -0,0 +1,32 @@
+//-------------------------------------------------------------
+//! @file   Module.hpp
+//! @brief  依存性注入コンテナライブラリのモジュール定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include "TypeId.hpp" // TypeId
+#include <vector>     // std::vector
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	class Container;
+
+	//-------------------------------------------------------------
+	//! @struct  ModuleExports
+	//! @brief   モジュールが公開する型のリスト
+	//! @details モジュールは次の 2 つを定義する。
+	//!          - using Exports = ModuleExports<公開する型...>;
+	//!          - static void configure(Container& container);  // 公開する型を登録する
+	//-------------------------------------------------------------
+	template<typename... TExports>
+	struct ModuleExports {
+		//! @brief 公開する型のキー一覧を取得
+		static std::vector<TypeId> keys() {
+			return { typeId<TExports>()... };
+		}
+	};
+
+	//-------------------------------------------------------------
+	//! @brief  モジュールの登録関数の型
+	//-------------------------------------------------------------
+	using ModuleConfigureFn = void(*)(Container&);
+}// namespace TsukinoDIContainer
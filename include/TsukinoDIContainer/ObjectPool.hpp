@@ -0,0 +1,156 @@
+//-------------------------------------------------------------
+//! @file   ObjectPool.hpp
+//! @brief  依存性注入コンテナライブラリの Pooled ライフサイクル用オブジェクトプール定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>      // std::size_t, std::max_align_t
+#include <cstdint>      // std::uint64_t
+#include <memory>       // std::shared_ptr, std::enable_shared_from_this
+#include <mutex>        // std::mutex
+#include <vector>       // std::vector
+#include <atomic>       // std::atomic
+#include <type_traits>  // std::void_t
+#include <utility>      // std::declval
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @class   ObjectPool
+	//! @brief   1 つの登録に対応する上限付きオブジェクトプール
+	//! @details 貸し出したハンドル（std::shared_ptr）が解放されると reset フックを呼び、
+	//!          オブジェクトをプールへ戻す。空きはスレッドローカルの小さなリストに優先して置き、
+	//!          溢れた分を共有リストへ移す。ハンドルの制御ブロックは各オブジェクトに付随する
+	//!          領域に配置するため、プールから取り出す解決ではメモリ確保も構築も行わない。
+	//!          上限（capacity）は共有リストの空き数に対するもので、スレッドローカルリストの分は含まない。
+	//!          各スレッドはプールごとに最大 kLocalCapacity 個を上限とは別に保持しうる。
+	//!          スレッドローカルリストはプールを生存させず（弱参照と通し番号で識別）、
+	//!          プールの破棄時は他スレッドのリストに残った空きオブジェクトも含めて破棄する。
+	//-------------------------------------------------------------
+	class ObjectPool : public std::enable_shared_from_this<ObjectPool> {
+	public:
+		using ResetFn = void(*)(void*);		// reset フック（型消去）
+
+		static constexpr std::size_t kDefaultCapacity = 64;		// 保持する空きオブジェクト数の既定上限
+		static constexpr std::size_t kLocalCapacity = 8;		// スレッドローカルリストの容量
+		static constexpr std::size_t kControlBlockSize = 128;	// オブジェクトごとの制御ブロック用領域
+
+		//---------------------------------------------------------
+		//! @struct  Slot
+		//! @brief   プールされたオブジェクト 1 つと、その制御ブロック用領域
+		//---------------------------------------------------------
+		struct Slot {
+			std::shared_ptr<void> object_;											// 所有するオブジェクト
+			std::shared_ptr<ObjectPool> owner_;										// 貸し出し中はプールを生存させる
+			bool discard_ = false;													// reset に失敗したため再利用しない
+			Slot* prev_ = nullptr;													// プールが所有するスロットの一覧（前）
+			Slot* next_ = nullptr;													// プールが所有するスロットの一覧（次）
+			alignas(std::max_align_t) unsigned char block_[kControlBlockSize];		// ハンドルの制御ブロック用領域
+		};
+
+		//---------------------------------------------------------
+		// コンストラクタ
+		//! @param  reset     [in] 返却時に呼ぶフック（nullptr ならなし）
+		//! @param  capacity  [in] 保持する空きオブジェクト数の上限
+		//---------------------------------------------------------
+		explicit ObjectPool(ResetFn reset, std::size_t capacity = kDefaultCapacity);
+
+		//---------------------------------------------------------
+		// デストラクタ
+		//! @details 共有リストと各スレッドのローカルリストに残った空きオブジェクトを破棄する
+		//!          （貸し出し中のハンドルはプールを生存させるため、この時点で全て空き）
+		//---------------------------------------------------------
+		~ObjectPool();
+
+		//---------------------------------------------------------
+		// 空きオブジェクトを貸し出す
+		//! @return ハンドル（空きがなければ nullptr）
+		//---------------------------------------------------------
+		std::shared_ptr<void> tryAcquire();
+
+		//---------------------------------------------------------
+		// 新しく構築したオブジェクトをプール管理下に置いて貸し出す
+		//! @param  object  [in] 構築済みのオブジェクト
+		//! @return ハンドル
+		//---------------------------------------------------------
+		std::shared_ptr<void> adopt(std::shared_ptr<void> object);
+
+		//---------------------------------------------------------
+		// 保持する空きオブジェクト数の上限を設定
+		//! @param  capacity  [in] 共有リストの上限（スレッドローカルリストの分は含まない）
+		//---------------------------------------------------------
+		void setCapacity(std::size_t capacity);
+
+		//---------------------------------------------------------
+		// 共有リストの空きオブジェクト数を取得
+		//! @return 空きオブジェクト数（スレッドローカルリスト分は含まない）
+		//---------------------------------------------------------
+		std::size_t sharedIdleCount() const;
+
+		//---------------------------------------------------------
+		// 返却されたスロットを受け取る（ハンドルの制御ブロック解放時に呼ばれる）
+		//! @param  slot  [in] 返却されたスロット
+		//---------------------------------------------------------
+		void release(Slot* slot);
+
+		//---------------------------------------------------------
+		// スロットを共有リストへまとめて戻す（上限を超えた分は破棄）
+		//! @param  slots  [in] スロット配列
+		//! @param  count  [in] 個数
+		//---------------------------------------------------------
+		void returnShared(Slot* const* slots, std::size_t count);
+
+		//---------------------------------------------------------
+		// reset フックを呼ぶ
+		//! @param  slot  [in] 返却されたスロット
+		//---------------------------------------------------------
+		void resetObject(Slot* slot) noexcept;
+
+		//---------------------------------------------------------
+		// 通し番号を取得
+		//! @return プールごとに一意な番号（スレッドローカルリストの対応確認用、アドレスが再利用されても一致しない）
+		//---------------------------------------------------------
+		std::uint64_t serial() const noexcept { return serial_; }
+
+	private:
+		//---------------------------------------------------------
+		// スロットを一覧から外して破棄
+		//! @param  slots  [in] スロット配列
+		//! @param  count  [in] 個数
+		//---------------------------------------------------------
+		void destroy(Slot* const* slots, std::size_t count);
+
+		//---------------------------------------------------------
+		// スロットを一覧から外す（mutex_ を保持していること）
+		//---------------------------------------------------------
+		void unlink(Slot* slot) noexcept;
+
+		//---------------------------------------------------------
+		// スロットからハンドルを作成
+		//---------------------------------------------------------
+		std::shared_ptr<void> makeHandle(Slot* slot);
+
+		ResetFn reset_;								// reset フック
+		const std::uint64_t serial_;				// 通し番号
+		std::atomic<std::size_t> capacity_;			// 共有リストの空きオブジェクト数の上限
+		mutable std::mutex mutex_;					// 共有リストとスロット一覧の保護用
+		std::vector<Slot*> shared_;					// 共有リスト（スレッドローカルから溢れた分）
+		Slot* slots_ = nullptr;						// 所有する全スロットの一覧（貸し出し中・各スレッドのローカルリスト分を含む）
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  reset() を持つ型のフックを取得
+		//! @details プールが保持するポインタは抽象型を指すため、抽象型を経由して具象型へ戻す
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename = void>
+		struct ResetHook {
+			static constexpr ObjectPool::ResetFn get() { return nullptr; }
+		};
+		template<typename TInterface, typename TImplementation>
+		struct ResetHook<TInterface, TImplementation, std::void_t<decltype(std::declval<TImplementation&>().reset())>> {
+			static constexpr ObjectPool::ResetFn get() {
+				return [](void* object) { static_cast<TImplementation*>(static_cast<TInterface*>(object))->reset(); };
+			}
+		};
+	}
+}// namespace TsukinoDIContainer
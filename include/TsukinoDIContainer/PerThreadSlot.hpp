@@ -0,0 +1,59 @@
+//-------------------------------------------------------------
+//! @file   PerThreadSlot.hpp
+//! @brief  依存性注入コンテナライブラリの PerThread ライフサイクル用スロット定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <memory>   // std::shared_ptr
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @class   PerThreadSlot
+	//! @brief   登録 1 つ分のスレッドごとのインスタンス格納位置
+	//! @details 各スレッドはスレッドローカルな配列を持ち、登録ごとに割り当てた
+	//!          添字でインスタンスを参照する（ロックも共有変数への書き込みもなし）。
+	//!          添字は登録の破棄時に再利用されるため、一意なトークンで所有者を判定する。
+	//!          インスタンスはスロットの破棄後、各スレッドが次にいずれかのスロットへアクセスした時点か、
+	//!          スレッド終了時に破棄される。
+	//-------------------------------------------------------------
+	class PerThreadSlot {
+	public:
+		//---------------------------------------------------------
+		// コンストラクタ
+		//! @details 空いている添字と新しいトークンを割り当てる
+		//---------------------------------------------------------
+		PerThreadSlot();
+
+		//---------------------------------------------------------
+		// デストラクタ
+		//! @details 添字を返却し、破棄の世代を進める（各スレッドに残ったインスタンスは、
+		//!          そのスレッドが次に get / set を呼んだ時点かスレッド終了時に破棄される）
+		//---------------------------------------------------------
+		~PerThreadSlot();
+
+		//---------------------------------------------------------
+		// コピー禁止
+		//---------------------------------------------------------
+		PerThreadSlot(const PerThreadSlot&) = delete;
+		PerThreadSlot& operator=(const PerThreadSlot&) = delete;
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドのインスタンスを取得
+		//! @return インスタンスへのポインタ（未生成なら nullptr、次の get / set まで有効）
+		//! @details 破棄されたスロットがあれば、先に呼び出しスレッドに残ったインスタンスを解放する
+		//---------------------------------------------------------
+		const std::shared_ptr<void>* get() const;
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドのインスタンスを設定
+		//! @param  instance  [in] インスタンス
+		//---------------------------------------------------------
+		void set(std::shared_ptr<void> instance) const;
+
+	private:
+		std::size_t index_;		// スレッドローカル配列の添字
+		std::uint64_t token_;	// 所有者判定用の一意な値
+	};
+}// namespace TsukinoDIContainer
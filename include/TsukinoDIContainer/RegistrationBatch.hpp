@@ -0,0 +1,269 @@
+//-------------------------------------------------------------
+//! @file   RegistrationBatch.hpp
+//! @brief  依存性注入コンテナライブラリの一括登録定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <memory>      // std::shared_ptr
+#include <new>         // placement new
+#include <vector>      // std::vector
+#include <functional>  // std::function
+#include "TypeId.hpp"  // TypeId
+#include <utility>     // std::index_sequence
+#include "Lifecycle.hpp"   // ライフサイクル enum
+#include "ObjectPool.hpp"  // ObjectPool::ResetFn
+#include "InstanceCache.hpp" // InstanceCache::SizeFn
+#include "ConstructorDeduction.hpp" // コンストラクタ引数推論
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	using FactoryFn = std::shared_ptr<void>(*)(const std::vector<std::shared_ptr<void>>&);	// 型消去したファクトリ関数ポインタ
+	using PlaceFn = void*(*)(void*, const std::vector<std::shared_ptr<void>>*);				// 型消去した配置構築関数ポインタ（依存が nullptr なら破棄）
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  BulkLayout
+		//! @brief   連続領域への一括構築に必要な情報（Container::resolveN で使用）
+		//---------------------------------------------------------
+		struct BulkLayout {
+			PlaceFn place_ = nullptr;		// 配置構築関数（nullptr なら一括構築しない）
+			std::size_t size_ = 0;			// 具象型のサイズ
+			std::size_t align_ = 0;			// 具象型のアライメント
+		};
+	}
+
+	//-------------------------------------------------------------
+	//! @struct  StaticRegistration
+	//! @brief   コンパイル時に構築できる登録情報
+	//! @details bindType / bindCtor で生成し、constexpr 配列として定義できる。
+	//!          RegistrationBatch::add で一括登録に追加する。
+	//-------------------------------------------------------------
+	struct StaticRegistration {
+		TypeId type_;							// 抽象型インターフェース
+		Lifecycle cycle_;						// ライフサイクル
+		const TypeId* deps_;					// 依存型リスト
+		std::size_t depCount_;					// 依存型の数
+		FactoryFn factory_;						// ファクトリ関数
+		ObjectPool::ResetFn reset_;				// Pooled 返却時のフック
+		InstanceCache::SizeFn size_;			// Cached のサイズ取得
+		detail::NoteGenericsFn generics_;		// オープンジェネリックの依存型の記録（対象がなければ nullptr）
+		detail::BulkLayout bulk_;				// 連続領域への一括構築
+		std::uint32_t refDeps_;					// 参照で受け取る依存（依存型リストの位置のビット）
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  依存型リストの静的配列（末尾は番兵）
+		//---------------------------------------------------------
+		template<typename... TDeps>
+		struct StaticDeps {
+			static constexpr TypeId value[sizeof...(TDeps) + 1] = { typeId<TDeps>()..., TypeId() };
+		};
+
+		//---------------------------------------------------------
+		//! @brief  推論した依存型リストの静的配列
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename TSequence>
+		struct AutoStaticDeps;
+		template<typename TInterface, typename TImplementation, std::size_t... I>
+		struct AutoStaticDeps<TInterface, TImplementation, std::index_sequence<I...>>
+			: StaticDeps<typename AutoCtor<TInterface, TImplementation>::template Traits<I>::Dependency...> {};
+
+		//---------------------------------------------------------
+		//! @brief  依存を静的ポインタキャストしてコンストラクタを呼ぶファクトリ
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename... TDeps, std::size_t... I>
+		inline std::shared_ptr<void> staticFactoryImpl(const std::vector<std::shared_ptr<void>>& args, std::index_sequence<I...>) {
+			std::shared_ptr<TInterface> created = std::make_shared<TImplementation>(std::static_pointer_cast<TDeps>(args[I])...);
+			return created;
+		}
+		template<typename TInterface, typename TImplementation, typename... TDeps>
+		inline std::shared_ptr<void> staticFactory(const std::vector<std::shared_ptr<void>>& args) {
+			return staticFactoryImpl<TInterface, TImplementation, TDeps...>(args, std::index_sequence_for<TDeps...>{});
+		}
+
+		//---------------------------------------------------------
+		//! @brief  依存を静的ポインタキャストして指定位置に構築する（依存が nullptr なら破棄）
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename... TDeps, std::size_t... I>
+		inline void* staticPlaceImpl(void* where, const std::vector<std::shared_ptr<void>>& args, std::index_sequence<I...>) {
+			(void)args;
+			TInterface* created = ::new (where) TImplementation(std::static_pointer_cast<TDeps>(args[I])...);
+			return created;
+		}
+		template<typename TInterface, typename TImplementation, typename... TDeps>
+		inline void* staticPlace(void* where, const std::vector<std::shared_ptr<void>>* args) {
+			if (!args) {
+				static_cast<TImplementation*>(where)->~TImplementation();
+				return nullptr;
+			}
+			return staticPlaceImpl<TInterface, TImplementation, TDeps...>(where, *args, std::index_sequence_for<TDeps...>{});
+		}
+	}
+
+	//-------------------------------------------------------------
+	// コンパイル時登録情報を生成（依存付き）
+	//! @tparam TInterface       抽象型インターフェース
+	//! @tparam TImplementation  具象型実装
+	//! @tparam TDeps            依存型リスト
+	//! @param  cycle  [in] ライフサイクル管理方法（デフォルトはTransient）
+	//! @return 登録情報
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation, typename... TDeps>
+	constexpr StaticRegistration bindCtor(Lifecycle cycle = Lifecycle::Transient) {
+		return StaticRegistration{
+			typeId<TInterface>(),
+			cycle,
+			detail::StaticDeps<TDeps...>::value,
+			sizeof...(TDeps),
+			&detail::staticFactory<TInterface, TImplementation, TDeps...>,
+			detail::ResetHook<TInterface, TImplementation>::get(),
+			detail::SizeHook<TInterface, TImplementation>::get(),
+			detail::noteGenericsFn<TDeps...>(),
+			detail::BulkLayout{ &detail::staticPlace<TInterface, TImplementation, TDeps...>, sizeof(TImplementation), alignof(TImplementation) },
+			0	// 依存は全て std::shared_ptr で渡す
+		};
+	}
+
+	//-------------------------------------------------------------
+	// コンパイル時登録情報を生成（依存はコンストラクタから推論）
+	//! @tparam TInterface       抽象型インターフェース
+	//! @tparam TImplementation  具象型実装
+	//! @param  cycle  [in] ライフサイクル管理方法（デフォルトはTransient）
+	//! @return 登録情報
+	//! @details 推論規則は Container::registerType と同じ（Lazy<T> 引数は使用不可）
+	//-------------------------------------------------------------
+	template<typename TInterface, typename TImplementation>
+	constexpr StaticRegistration bindType(Lifecycle cycle = Lifecycle::Transient) {
+		using Ctor = detail::AutoCtor<TInterface, TImplementation>;
+		return StaticRegistration{
+			typeId<TInterface>(),
+			cycle,
+			detail::AutoStaticDeps<TInterface, TImplementation, typename Ctor::Sequence>::value,
+			Ctor::kArity,
+			&Ctor::createStatic,
+			detail::ResetHook<TInterface, TImplementation>::get(),
+			detail::SizeHook<TInterface, TImplementation>::get(),
+			Ctor::noteGenericsFn(),
+			detail::BulkLayout{ &Ctor::placeStatic, sizeof(TImplementation), alignof(TImplementation) },
+			Ctor::refMask()
+		};
+	}
+
+	//-------------------------------------------------------------
+	//! @class   RegistrationBatch
+	//! @brief   ロックを取らずに登録を集め、Container::registerBatch で一括登録するビルダー
+	//! @details 重複は確定時に 1 回の走査でまとめて検出し、1 件でもあれば何も登録しない。
+	//!          確定時は対象シャードを一度だけロックし、容量を確保してから挿入する。
+	//-------------------------------------------------------------
+	class RegistrationBatch {
+	public:
+		//---------------------------------------------------------
+		//! @struct  Entry
+		//! @brief   一括登録の 1 件
+		//---------------------------------------------------------
+		struct Entry {
+			TypeId type_;															// 抽象型インターフェース
+			Lifecycle cycle_ = Lifecycle::Transient;												// ライフサイクル
+			std::vector<TypeId> deps_;														// 依存型リスト
+			std::function<std::shared_ptr<void>(const std::vector<std::shared_ptr<void>>&)> ctor_;	// ファクトリ関数
+			ObjectPool::ResetFn reset_ = nullptr;													// Pooled 返却時のフック
+			InstanceCache::SizeFn size_ = nullptr;													// Cached のサイズ取得
+			detail::NoteGenericsFn generics_ = nullptr;												// オープンジェネリックの依存型の記録
+			detail::BulkLayout bulk_{};																// 連続領域への一括構築
+			std::shared_ptr<void> instance_;														// 登録済みインスタンス（registerInstance 相当）
+			std::uint32_t refDeps_ = 0;																// 参照で受け取る依存（依存型リストの位置のビット）
+		};
+
+		//---------------------------------------------------------
+		// 容量を確保
+		//! @param  count  [in] 追加予定の件数
+		//---------------------------------------------------------
+		RegistrationBatch& reserve(std::size_t count) {
+			entries_.reserve(count);
+			return *this;
+		}
+
+		//---------------------------------------------------------
+		// コンパイル時登録情報を追加
+		//! @param  reg  [in] bindType / bindCtor で生成した登録情報
+		//---------------------------------------------------------
+		RegistrationBatch& add(const StaticRegistration& reg) {
+			Entry entry;
+			entry.type_ = reg.type_;
+			entry.cycle_ = reg.cycle_;
+			entry.deps_.reserve(reg.depCount_);
+			for (std::size_t i = 0; i < reg.depCount_; ++i) {
+				entry.deps_.push_back(reg.deps_[i]);
+			}
+			entry.ctor_ = reg.factory_;
+			entry.reset_ = reg.reset_;
+			entry.size_ = reg.size_;
+			entry.generics_ = reg.generics_;
+			entry.bulk_ = reg.bulk_;
+			entry.refDeps_ = reg.refDeps_;
+			entries_.push_back(std::move(entry));
+			return *this;
+		}
+
+		//---------------------------------------------------------
+		// コンパイル時登録情報の配列を追加
+		//! @param  regs  [in] bindType / bindCtor で生成した登録情報の配列
+		//---------------------------------------------------------
+		template<std::size_t N>
+		RegistrationBatch& add(const StaticRegistration (&regs)[N]) {
+			entries_.reserve(entries_.size() + N);
+			for (const auto& reg : regs) {
+				add(reg);
+			}
+			return *this;
+		}
+
+		//---------------------------------------------------------
+		// 型登録を追加（Container::registerType 相当）
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation>
+		RegistrationBatch& registerType(Lifecycle cycle = Lifecycle::Transient) {
+			return add(bindType<TInterface, TImplementation>(cycle));
+		}
+
+		//---------------------------------------------------------
+		// 依存付き型登録を追加（Container::registerCtor 相当）
+		//---------------------------------------------------------
+		template<typename TInterface, typename TImplementation, typename... TDeps>
+		RegistrationBatch& registerCtor(Lifecycle cycle = Lifecycle::Transient) {
+			return add(bindCtor<TInterface, TImplementation, TDeps...>(cycle));
+		}
+
+		//---------------------------------------------------------
+		// インスタンス登録を追加（Container::registerInstance 相当）
+		//---------------------------------------------------------
+		template<typename TInterface>
+		RegistrationBatch& registerInstance(std::shared_ptr<TInterface> instance) {
+			Entry entry;
+			entry.type_ = typeId<TInterface>();
+			entry.cycle_ = Lifecycle::Singleton;
+			entry.instance_ = instance;
+			entry.ctor_ = [instance](const std::vector<std::shared_ptr<void>>&) { return std::shared_ptr<void>(instance); };
+			entries_.push_back(std::move(entry));
+			return *this;
+		}
+
+		//---------------------------------------------------------
+		// 追加済みの登録を取得
+		//! @return 登録一覧
+		//---------------------------------------------------------
+		const std::vector<Entry>& entries() const { return entries_; }
+
+		//---------------------------------------------------------
+		// 追加済みの件数を取得
+		//! @return 件数
+		//---------------------------------------------------------
+		std::size_t size() const { return entries_.size(); }
+
+	private:
+		friend class Container;
+		std::vector<Entry> entries_;	// 追加済みの登録
+	};
+}// namespace TsukinoDIContainer
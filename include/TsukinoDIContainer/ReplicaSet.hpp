@@ -0,0 +1,140 @@
+//-------------------------------------------------------------
+//! @file   ReplicaSet.hpp
+//! @brief  依存性注入コンテナライブラリの Replicated ライフサイクル用レプリカ定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <atomic>        // std::atomic
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint64_t
+#include <memory>        // std::shared_ptr, std::unique_ptr
+#include <shared_mutex>  // std::shared_mutex
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @enum   ReplicaGranularity
+	//! @brief  Replicated ライフサイクルのレプリカの単位
+	//-------------------------------------------------------------
+	enum class ReplicaGranularity : std::uint8_t {
+		NumaNode,	//!< NUMA ノードごと（既定、単一ノードの環境では 1 つ）
+		Cpu			//!< 論理 CPU ごと
+	};
+
+	//-------------------------------------------------------------
+	//! @class   CpuTopology
+	//! @brief   実行環境の CPU / NUMA ノード構成
+	//! @details 初回呼び出し時に 1 回だけ検出する。
+	//!          Linux は /sys/devices/system/{cpu,node} と sched_getcpu、Windows は NUMA API を使う。
+	//!          検出できない環境では CPU 数は hardware_concurrency、ノード数は 1 とする。
+	//-------------------------------------------------------------
+	class CpuTopology {
+	public:
+		//---------------------------------------------------------
+		// 論理 CPU 数を取得
+		//! @return 論理 CPU 数（1 以上）
+		//---------------------------------------------------------
+		static std::size_t cpuCount();
+
+		//---------------------------------------------------------
+		// NUMA ノード数を取得
+		//! @return ノード数（1 以上）
+		//---------------------------------------------------------
+		static std::size_t nodeCount();
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドが実行中の論理 CPU を取得
+		//! @return CPU 番号（0 ～ cpuCount() - 1、取得できなければ 0）
+		//! @details スレッドは移動しうるため、戻った時点で別の CPU で実行している場合がある
+		//---------------------------------------------------------
+		static std::size_t currentCpu() noexcept;
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドが実行中の NUMA ノードを取得
+		//! @return ノード番号（0 ～ nodeCount() - 1 に詰めた値）
+		//---------------------------------------------------------
+		static std::size_t currentNode() noexcept;
+	};
+
+	//-------------------------------------------------------------
+	//! @class   ReplicaSet
+	//! @brief   登録 1 つ分の CPU / NUMA ノードごとのインスタンス
+	//! @details スロットは論理 CPU 数だけ確保し、キャッシュライン境界に揃える。
+	//!          各スロットは同じノード（CPU）のスレッドからのみ参照されるため、
+	//!          ロックや参照カウントのキャッシュラインがソケットを越えて行き来しない。
+	//!          インスタンスは初めて解決したそのノードのスレッドで構築する（first-touch でメモリもノードに置かれる）。
+	//!          invalidate で世代を進めると、全てのレプリカが同時に無効となり、各ノードで次の解決時に再構築される。
+	//-------------------------------------------------------------
+	class ReplicaSet {
+	public:
+		//---------------------------------------------------------
+		// コンストラクタ
+		//---------------------------------------------------------
+		ReplicaSet();
+
+		//---------------------------------------------------------
+		// コピー禁止
+		//---------------------------------------------------------
+		ReplicaSet(const ReplicaSet&) = delete;
+		ReplicaSet& operator=(const ReplicaSet&) = delete;
+
+		//---------------------------------------------------------
+		// 現在の世代を取得
+		//! @return 世代（構築前に取得し、get / set に渡す）
+		//---------------------------------------------------------
+		std::uint64_t generation() const noexcept { return generation_.load(std::memory_order_acquire); }
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドのノード（CPU）のレプリカを取得
+		//! @param  generation  [in] 世代
+		//! @return インスタンス（未構築、または古い世代なら nullptr）
+		//---------------------------------------------------------
+		std::shared_ptr<void> get(std::uint64_t generation) const;
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドのノード（CPU）のレプリカを設定
+		//! @param  generation  [in] 構築前に取得した世代
+		//! @param  instance    [in] 構築したインスタンス
+		//! @return 保持しているレプリカ（他スレッドが先に設定していればそちら）
+		//! @details 構築中に世代が進んだ場合は保持せずにそのまま返す
+		//---------------------------------------------------------
+		std::shared_ptr<void> set(std::uint64_t generation, std::shared_ptr<void> instance);
+
+		//---------------------------------------------------------
+		// 全てのレプリカを無効化（世代を進めて古いレプリカを手放す）
+		//---------------------------------------------------------
+		void invalidate();
+
+		//---------------------------------------------------------
+		// レプリカの単位を設定（全てのレプリカを無効化する）
+		//! @param  granularity  [in] 単位
+		//---------------------------------------------------------
+		void setGranularity(ReplicaGranularity granularity);
+
+		//---------------------------------------------------------
+		// 構築済みのレプリカ数を取得
+		//! @return 現在の世代のレプリカ数
+		//---------------------------------------------------------
+		std::size_t replicaCount() const;
+
+	private:
+		//---------------------------------------------------------
+		//! @struct  Slot
+		//! @brief   ノード（CPU）1 つ分のレプリカ
+		//---------------------------------------------------------
+		struct alignas(64) Slot {
+			mutable std::shared_mutex mutex_;	// 同じノードのスレッド間でのみ競合する
+			std::shared_ptr<void> instance_;	// レプリカ
+			std::uint64_t generation_ = 0;		// 構築した世代
+		};
+
+		//---------------------------------------------------------
+		// 呼び出しスレッドのスロットを取得
+		//---------------------------------------------------------
+		Slot& localSlot() const noexcept;
+
+		std::unique_ptr<Slot[]> slots_;									// スロット配列（論理 CPU 数）
+		std::size_t count_;												// スロット数
+		std::atomic<std::uint64_t> generation_{ 1 };					// 世代
+		std::atomic<ReplicaGranularity> granularity_{ ReplicaGranularity::NumaNode };	// レプリカの単位
+	};
+}// namespace TsukinoDIContainer
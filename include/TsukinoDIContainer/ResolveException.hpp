@@ -1,23 +1,103 @@
 //-------------------------------------------------------------
 //! @file   ResolveException.hpp
-//! @brief  ˑReiCu̗O`
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリの例外定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
-#include <stdexcept> 
+#include <stdexcept>
 #include <string>
-// O : TsukinoDIContainer
+#include <vector>
+#include <memory>
+#include <mutex>
+#include "TypeId.hpp"
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @enum   ResolveErrorCode
+	//! @brief  解決エラーの種類
+	//-------------------------------------------------------------
+	enum class ResolveErrorCode {
+		None,				//!< エラーなし
+		NotRegistered,		//!< 未登録型
+		AlreadyRegistered,	//!< 登録済み型の再登録
+		CircularDependency,	//!< 循環依存
+		AsyncOnly,			//!< 非同期ファクトリの型を同期解決
+		Other				//!< その他（メッセージ文字列のみ）
+	};
+
+	//-------------------------------------------------------------
+	// 型の表示名を取得
+	//! @param  type  [in] 型
+	//! @return 型名（コンパイル時に求めた type.name()、デマングル不要）
+	//-------------------------------------------------------------
+	std::string typeName(const TypeId& type);
+
+	//-------------------------------------------------------------
+	// 型の表示名を取得
+	//! @param  rawName  [in] 処理系の型名（std::type_info::name）
+	//! @return デマングル済みの型名（デマングルできない処理系では rawName）
+	//-------------------------------------------------------------
+	std::string typeName(const char* rawName);
+
 	//-------------------------------------------------------------
 	//! @class  ResolveException
-	//! @brief  G[ONX
+	//! @brief  解決エラー例外クラス
+	//! @details エラーコードと関係する型のみを保持し、メッセージ文字列は
+	//!          what() が初めて呼ばれた時点で組み立てる（コンパイル時に求めた型名を使用）
 	//-------------------------------------------------------------
 	class ResolveException : public std::runtime_error {
 	public:
 		//-------------------------------------------------------------
-		// RXgN^
-		//! @param  msg G[bZ[W
+		// コンストラクタ
+		//! @param  msg エラーメッセージ
 		//-------------------------------------------------------------
 		explicit ResolveException(const std::string& msg);
+
+		//-------------------------------------------------------------
+		// コンストラクタ
+		//! @param  code   [in] エラーコード
+		//! @param  types  [in] 関係する型（循環依存の場合は解決中の連鎖）
+		//-------------------------------------------------------------
+		ResolveException(ResolveErrorCode code, std::vector<TypeId> types);
+
+		//-------------------------------------------------------------
+		// コンストラクタ
+		//! @param  code  [in] エラーコード
+		//! @param  type  [in] 関係する型
+		//-------------------------------------------------------------
+		ResolveException(ResolveErrorCode code, const TypeId& type);
+
+		//-------------------------------------------------------------
+		// エラーメッセージを取得
+		//! @return エラーメッセージ（初回呼び出し時に組み立てる）
+		//-------------------------------------------------------------
+		const char* what() const noexcept override;
+
+		//-------------------------------------------------------------
+		// エラーコードを取得
+		//! @return エラーコード
+		//-------------------------------------------------------------
+		ResolveErrorCode code() const noexcept;
+
+		//-------------------------------------------------------------
+		// 関係する型を取得
+		//! @return 関係する型（文字列のみで生成した場合は空）
+		//-------------------------------------------------------------
+		const std::vector<TypeId>& types() const noexcept;
+
+	private:
+		//---------------------------------------------------------
+		//! @struct Detail
+		//! @brief  例外のコピー間で共有する詳細情報
+		//! @details 例外は exception_ptr 経由で複数スレッドから参照されうるため、
+		//!          メッセージの組み立ては call_once で 1 回だけ行う
+		//---------------------------------------------------------
+		struct Detail {
+			ResolveErrorCode code_ = ResolveErrorCode::Other;	// エラーコード
+			std::vector<TypeId> types_;				// 関係する型
+			std::string text_;									// 組み立て済みメッセージ（または指定されたメッセージ）
+			std::once_flag formatted_;							// メッセージ組み立て済みフラグ
+		};
+		std::shared_ptr<Detail> detail_;	// 詳細情報
 	};
-}// namespace TsukinoDIContainer
\ No newline at end of file
+}// namespace TsukinoDIContainer
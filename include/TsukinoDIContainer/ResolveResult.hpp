@@ -0,0 +1,72 @@
+//-------------------------------------------------------------
+//! @file   ResolveResult.hpp
+//! @brief  依存性注入コンテナライブラリの例外を投げない解決結果定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <memory>     // std::shared_ptr
+#include "TypeId.hpp" // TypeId
+#include <utility>    // std::move
+#include "ResolveException.hpp" // ResolveErrorCode
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @struct  ResolveError
+	//! @brief   解決エラーの要約（メッセージ文字列を持たず、確保なしでコピー可能）
+	//-------------------------------------------------------------
+	struct ResolveError {
+		ResolveErrorCode code_ = ResolveErrorCode::None;	// エラーコード
+		TypeId type_;				// 解決に失敗した型
+	};
+
+	//-------------------------------------------------------------
+	//! @class   ResolveResult
+	//! @brief   Container::tryResolve の結果
+	//! @tparam  TInterface 抽象型インターフェース
+	//! @details 成功時はインスタンス、失敗時はエラーコードと失敗した型を保持する
+	//-------------------------------------------------------------
+	template<typename TInterface>
+	class ResolveResult {
+	public:
+		//-------------------------------------------------------------
+		// コンストラクタ（成功）
+		//! @param  value  [in] 解決されたインスタンス
+		//-------------------------------------------------------------
+		ResolveResult(std::shared_ptr<TInterface> value) : value_(std::move(value)) {}
+
+		//-------------------------------------------------------------
+		// コンストラクタ（失敗）
+		//! @param  error  [in] 解決エラー
+		//-------------------------------------------------------------
+		ResolveResult(const ResolveError& error) : error_(error) {}
+
+		//-------------------------------------------------------------
+		// 成功したか確認
+		//! @return 成功なら true
+		//-------------------------------------------------------------
+		bool ok() const noexcept { return error_.code_ == ResolveErrorCode::None; }
+		explicit operator bool() const noexcept { return ok(); }
+
+		//-------------------------------------------------------------
+		// インスタンスを取得
+		//! @return 解決されたインスタンス（失敗時は空）
+		//-------------------------------------------------------------
+		const std::shared_ptr<TInterface>& value() const noexcept { return value_; }
+
+		//-------------------------------------------------------------
+		// エラーコードを取得
+		//! @return エラーコード（成功時は None）
+		//-------------------------------------------------------------
+		ResolveErrorCode error() const noexcept { return error_.code_; }
+
+		//-------------------------------------------------------------
+		// 解決に失敗した型を取得
+		//! @return 失敗した型（依存先で失敗した場合はその依存先、成功時は void）
+		//-------------------------------------------------------------
+		const TypeId& errorType() const noexcept { return error_.type_; }
+
+	private:
+		std::shared_ptr<TInterface> value_;	// 解決されたインスタンス
+		ResolveError error_;				// 解決エラー
+	};
+}// namespace TsukinoDIContainer
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------
+//! @file   ResolveTrace.hpp
+//! @brief  依存性注入コンテナライブラリの解決トレース定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint8_t
+#include <string>     // std::string
+#include "TypeId.hpp" // TypeId
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @class   ResolveTrace
+	//! @brief   解決の開始・終了イベントをスレッドごとのリングバッファに記録する
+	//! @details Container::enableTracing(true) の間、resolve / ScopedContext::resolve が
+	//!          型ごとに開始・終了イベント（入れ子の深さ付き）を記録する。
+	//!          記録は呼び出しスレッド専用のバッファへの書き込みのみで、ロックを取らない。
+	//!          バッファが一杯になると古いイベントから上書きする。
+	//!          toChromeJson / writeChromeJson の出力は chrome://tracing や Perfetto で開ける。
+	//-------------------------------------------------------------
+	class ResolveTrace {
+	public:
+		static constexpr std::size_t kCapacity = 4096;	// スレッドごとに保持するイベント数
+
+		//---------------------------------------------------------
+		//! @enum   Category
+		//! @brief  イベントの分類
+		//---------------------------------------------------------
+		enum class Category : std::uint8_t {
+			Resolve,	//!< Container::resolve / tryResolve（依存の解決を含む）
+			Scoped		//!< ScopedContext::resolve
+		};
+
+		//---------------------------------------------------------
+		// 解決の開始を記録
+		//! @param  name      [in] 型名（TypeId::name、静的記憶域の文字列）
+		//! @param  category  [in] 分類
+		//---------------------------------------------------------
+		static void begin(const char* name, Category category) noexcept;
+
+		//---------------------------------------------------------
+		// 直前の begin に対応する解決の終了を記録
+		//---------------------------------------------------------
+		static void end() noexcept;
+
+		//---------------------------------------------------------
+		// 記録済みのイベントを Chrome trace 形式で取得
+		//! @return JSON 文字列（{"traceEvents":[...]}）
+		//! @details 記録中のスレッドがあっても呼び出せる（読み取り中に上書きされたイベントは除く）。
+		//!          上書きで開始を失った終了イベントは出力しない。
+		//---------------------------------------------------------
+		static std::string toChromeJson();
+
+		//---------------------------------------------------------
+		// 記録済みのイベントを Chrome trace 形式でファイルへ出力
+		//! @param  path  [in] 出力先
+		//! @return 書き込めた場合 true
+		//---------------------------------------------------------
+		static bool writeChromeJson(const std::string& path);
+
+		//---------------------------------------------------------
+		// 記録済みのイベントを破棄
+		//! @details 終了したスレッドのバッファもここで解放する
+		//---------------------------------------------------------
+		static void clear();
+	};
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @class   TraceScope
+		//! @brief   解決 1 回分の開始・終了を記録する RAII ガード
+		//! @details key が nullptr（トレース無効）の場合は何もしない
+		//---------------------------------------------------------
+		class TraceScope {
+		public:
+			TraceScope(const TypeId* key, ResolveTrace::Category category) noexcept
+				: active_(key != nullptr) {
+				if (active_) {
+					ResolveTrace::begin(key->name(), category);
+				}
+			}
+			~TraceScope() {
+				if (active_) {
+					ResolveTrace::end();
+				}
+			}
+			TraceScope(const TraceScope&) = delete;
+			TraceScope& operator=(const TraceScope&) = delete;
+
+		private:
+			bool active_;	// 開始を記録したか
+		};
+	}
+}// namespace TsukinoDIContainer
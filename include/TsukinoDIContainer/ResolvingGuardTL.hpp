@@ -1,30 +1,38 @@
 //-------------------------------------------------------------
 //! @file   ResolvingGuardTL.hpp
-//! @brief  ˑReiCȕzˑopK[h`
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリの循環依存検出用ガード定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
-#include <typeindex>
+#include "TypeId.hpp"
+#include <new>
 namespace TsukinoDIContainer {
 	//---------------------------------------------------------
 	//! @struct  ResolvingGuardTL
-	//! @brief   zˑopK[hNXiXbh[Jj
-	//! @details RXgN^ŃX^bNɌ^vbVAfXgN^Ń|bv
+	//! @brief   循環依存検出用ガードクラス（スレッドローカル）
+	//! @details コンストラクタでスタックに型をプッシュ、デストラクタでポップ
 	//---------------------------------------------------------
 	struct ResolvingGuardTL {
-		std::type_index type_;	// K[hΏۂ̌^
-		bool active_{ false };	// K[hLǂ̃tO
+		TypeId type_;	// ガード対象の型
+		bool active_{ false };	// ガードが有効かどうかのフラグ
 
 		//---------------------------------------------------------
-		//! @brief  RXgN^
-		//! @param  t  [in] K[hΏۂ̌^
-		//! @throws ResolveException zˑoꂽꍇ
+		//! @brief  コンストラクタ
+		//! @param  t  [in] ガード対象の型
+		//! @throws ResolveException 循環依存が検出された場合
 		//---------------------------------------------------------
-		explicit ResolvingGuardTL(std::type_index t);
+		explicit ResolvingGuardTL(TypeId t);
 
 		//---------------------------------------------------------
-		//! @brief  fXgN^
-		//! @details X^bN^|bv
+		//! @brief  コンストラクタ（例外を投げない版）
+		//! @param  t  [in] ガード対象の型
+		//! @details 循環依存が検出された場合はプッシュせず active_ を false のままにする
+		//---------------------------------------------------------
+		ResolvingGuardTL(TypeId t, std::nothrow_t);
+
+		//---------------------------------------------------------
+		//! @brief  デストラクタ
+		//! @details スタックから型をポップ
 		//---------------------------------------------------------
 		~ResolvingGuardTL();
 	};
@@ -1,13 +1,13 @@
 //-------------------------------------------------------------
 //! @file   ResolvingStack.hpp
-//! @brief  X^bNiXbh[Jj`
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  解決中スタック（スレッドローカル）定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
 #include <vector>
-#include <typeindex>
-// O : TsukinoDIContainer
+#include "TypeId.hpp"
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer
 {
-	extern thread_local std::vector<std::type_index> g_resolving_stack;
+	extern thread_local std::vector<TypeId> g_resolving_stack;
 }
\ No newline at end of file
@@ -1,66 +1,137 @@
 //-------------------------------------------------------------
 //! @file   TsukinoDIContainer.hpp
-//! @brief  ˑReiCũXR[vReLXg`
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリのスコープコンテキスト定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
 
 #include <memory>
 #include <unordered_map>
-#include <typeindex>
+#include "TypeId.hpp"
 #include <vector>
 #include <shared_mutex>
+#include <functional>
+#include "InstanceAccounting.hpp"
 
 namespace TsukinoDIContainer {
-	class Container; // O錾
+	class Container; // 前方宣言
 	//-------------------------------------------------------------
 	//! @class ScopedContext
-	//! @brief Scoped Ct^CǗp RAII NX
+	//! @brief Scoped ライフタイム管理用 RAII クラス
 	//-------------------------------------------------------------
 	class ScopedContext {
 	public:
 		//-------------------------------------------------------------
-		// RXgN^
-		//! @param  container  [in] Rei
+		// コンストラクタ
+		//! @param  container  [in] 所属するコンテナ
 		//-------------------------------------------------------------
 		explicit ScopedContext(Container& container);
 
 		//-------------------------------------------------------------
-		// fXgN^
+		// デストラクタ
 		//-------------------------------------------------------------
 		~ScopedContext();
 
 		//-------------------------------------------------------------
-		// Rs[֎~
+		// コピー禁止
 		//-------------------------------------------------------------
 		ScopedContext(const ScopedContext&) = delete;
 
 		//-------------------------------------------------------------
-		// Rs[֎~
+		// コピー禁止
 		//-------------------------------------------------------------
 		ScopedContext& operator=(const ScopedContext&) = delete;
 
 		//-------------------------------------------------------------
-		// [uRXgN^
-		//! @param	 other  [in] ړIuWFNg
-		//! @details [uAړ̃fXgN^ł̓XR[vIsȂ
-		//! @details [ũIuWFNggpȂŉ
+		// ムーブコンストラクタ
+		//! @param	 other  [in] 移動元オブジェクト
+		//! @details ムーブ後、移動元のデストラクタではスコープ終了処理を行わない
+		//! @details スコープ内のインスタンスと差し替えは移動先に引き継がれる
+		//! @details ムーブ元のオブジェクトを使用しないで下さい
 		//-------------------------------------------------------------
 		ScopedContext(ScopedContext&& other) noexcept;
 
 		//-------------------------------------------------------------
-		// ˑ֌W̉
-		//! @tparam  TInterface ی^C^[tF[X
-		//! @return  ꂽCX^X
-		//! @throws	 ResolveException o^^AzˑAmCtTCN̏ꍇ
-		//! @details Rei Resolve Ăяo
+		// 依存関係の解決
+		//! @tparam  TInterface 抽象型インターフェース
+		//! @return  解決されたインスタンス
+		//! @throws	 ResolveException 未登録型、循環依存、未知ライフサイクルの場合
+		//! @details コンテナの Resolve を呼び出す
 		//-------------------------------------------------------------
 		template<typename TInterface>
 		std::shared_ptr<TInterface> resolve();
 
+		//-------------------------------------------------------------
+		// スコープ内でのみインスタンスを差し替え
+		//! @tparam  TInterface 抽象型インターフェース
+		//! @param   instance  [in] 差し替えるインスタンス（テナント、認証情報、テストダブルなど）
+		//! @details このスコープの resolve と、そこから解決される依存にのみ適用する。
+		//!          コンテナの登録表は変更せず、ロックも取らない（他のスコープ・スレッドには影響しない）。
+		//!          Transient / Scoped の依存はスコープ内で構築して差し替えを反映し、
+		//!          Singleton / PerThread / Pooled / Cached / Replicated の依存は共有のまま解決する（差し替えを共有インスタンスに漏らさない）。
+		//!          既に解決済みのインスタンスには反映されないため、解決前に呼び出すこと。
+		//-------------------------------------------------------------
+		template<typename TInterface>
+		void override(std::shared_ptr<TInterface> instance);
+
+		//-------------------------------------------------------------
+		// スコープ内でのみ実装型を差し替え
+		//! @tparam  TInterface       抽象型インターフェース
+		//! @tparam  TImplementation  具象型実装
+		//! @details 依存はコンストラクタから推論する（registerType と同じ規則）。
+		//!          初回の解決時にスコープ内で 1 回だけ構築する。適用範囲は override と同じ。
+		//-------------------------------------------------------------
+		template<typename TInterface, typename TImplementation>
+		void overrideType();
+
+		//-------------------------------------------------------------
+		// このスコープで構築したインスタンスの型ごとの計上値を取得
+		//! @return 型ごとの構築数・破棄されていない数・概算サイズ・それぞれの最大値
+		//! @details TSUKINO_DI_INSTANCE_ACCOUNTING を 1 にしてビルドした場合のみ計上する（無効時は enabled_ が false で空）。
+		//!          スコープの resolve から構築した Transient / Scoped（依存を含む）が対象。
+		//!          スコープ終了後に live_ が 0 でなければ、スコープ外で保持され続けている。
+		//-------------------------------------------------------------
+		InstanceAccounting instanceAccounting() const;
+
 	private:
-		Container& container_;	// Reiւ̎Q
-		std::unordered_map<std::type_index, std::shared_ptr<void>> scoped_instances_;	// XR[vCX^X}bv
-		bool active_;			// XR[vLǂ̃tO
+		//-------------------------------------------------------------
+		//! @struct  Override
+		//! @brief   スコープ内の差し替え
+		//-------------------------------------------------------------
+		struct Override {
+			std::shared_ptr<void> instance_;		// 差し替えるインスタンス（overrideType は構築後に設定）
+			std::vector<TypeId> deps_;	// 依存型リスト（overrideType のみ）
+			std::function<std::shared_ptr<void>(const std::vector<std::shared_ptr<void>>&)> ctor_;	// ファクトリ関数（overrideType のみ）
+		};
+
+		//-------------------------------------------------------------
+		// キーによる型解決（スコープ内の差し替えを優先）
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 解決されたインスタンス
+		//-------------------------------------------------------------
+		std::shared_ptr<void> resolveByKey(const TypeId& key);
+
+		//-------------------------------------------------------------
+		// 依存の解決（差し替えがあれば Transient / Scoped をスコープ内で構築）
+		//! @param  key  [in] 型のキー（TypeId）
+		//! @return 解決されたインスタンス
+		//-------------------------------------------------------------
+		std::shared_ptr<void> resolveDependency(const TypeId& key);
+
+		//-------------------------------------------------------------
+		// 差し替えのインスタンスを取得（overrideType は初回のみ構築）
+		//! @param  key       [in] 型のキー（TypeId）
+		//! @param  override  [in,out] 差し替え
+		//! @return インスタンス
+		//-------------------------------------------------------------
+		std::shared_ptr<void> resolveOverride(const TypeId& key, Override& override);
+
+		Container& container_;	// 所属するコンテナへの参照
+		std::unordered_map<TypeId, std::shared_ptr<void>> scoped_instances_;	// スコープインスタンスマップ
+		std::unordered_map<TypeId, Override> overrides_;						// スコープ内の差し替え
+		bool active_;			// スコープが有効かどうかのフラグ
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+		detail::ScopeAccounting accounting_;	// スコープで構築したインスタンスの計上値
+#endif
 	};
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+//-------------------------------------------------------------
+//! @file   ThreadPoolExecutor.hpp
+//! @brief  依存性注入コンテナライブラリの簡易スレッドプール定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>            // std::size_t
+#include <functional>         // std::function
+#include <thread>             // std::thread
+#include <vector>             // std::vector
+#include <deque>              // std::deque
+#include <mutex>              // std::mutex
+#include <condition_variable> // std::condition_variable
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @class   ThreadPoolExecutor
+	//! @brief   非同期解決用の簡易スレッドプール
+	//! @details 投入されたジョブを固定数のワーカースレッドで FIFO 実行する。
+	//!          resolveAsync で独立した依存を並行に待つ際の実行先として使用する。
+	//-------------------------------------------------------------
+	class ThreadPoolExecutor {
+	public:
+		//-------------------------------------------------------------
+		// コンストラクタ
+		//! @param  threadCount  [in] ワーカースレッド数（0 の場合はハードウェア並列数）
+		//-------------------------------------------------------------
+		explicit ThreadPoolExecutor(std::size_t threadCount = 0);
+
+		//-------------------------------------------------------------
+		// デストラクタ
+		//! @details 投入済みのジョブを全て実行してからワーカーを終了する
+		//-------------------------------------------------------------
+		~ThreadPoolExecutor();
+
+		//-------------------------------------------------------------
+		// コピー禁止
+		//-------------------------------------------------------------
+		ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+
+		//-------------------------------------------------------------
+		// コピー禁止
+		//-------------------------------------------------------------
+		ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+		//-------------------------------------------------------------
+		// ジョブ投入
+		//! @param  job  [in] 実行する関数
+		//-------------------------------------------------------------
+		void post(std::function<void()> job);
+
+		//-------------------------------------------------------------
+		// ワーカースレッド数を取得
+		//! @return ワーカースレッド数
+		//-------------------------------------------------------------
+		std::size_t threadCount() const;
+
+	private:
+		//-------------------------------------------------------------
+		// ワーカースレッドの処理ループ
+		//-------------------------------------------------------------
+		void workerLoop();
+
+		std::vector<std::thread> workers_;				// ワーカースレッド
+		std::deque<std::function<void()>> jobs_;		// 待機中のジョブ
+		std::mutex mutex_;								// ジョブキュー保護用
+		std::condition_variable cv_;					// ジョブ到着通知
+		bool stopping_ = false;							// 終了要求フラグ
+	};
+}// namespace TsukinoDIContainer
@@ -1,11 +1,29 @@
 //-------------------------------------------------------------
 //! @file   TsukinoDIContainer.hpp
-//! @brief  ˑReiCu(include΂悢)
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリ(これをincludeすればよい)
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #pragma once
 #include "Lifecycle.hpp"
 #include "ResolveException.hpp"
+#include "ResolveResult.hpp"
 #include "Container.hpp"
 #include "ScopedContext.hpp"
-#include "ResolvingGuardTL.hpp"
\ No newline at end of file
+#include "ResolvingGuardTL.hpp"
+#include "ThreadPoolExecutor.hpp"
+#include "AsyncTask.hpp"
+#include "DependencyGraph.hpp"
+#include "ValidationReport.hpp"
+#include "Decorator.hpp"
+#include "RegistrationBatch.hpp"
+#include "Module.hpp"
+#include "ContainerManifest.hpp"
+#include "Lazy.hpp"
+#include "ConstructorDeduction.hpp"
+#include "LockProfile.hpp"
+#include "ResolveTrace.hpp"
+#include "InstanceCache.hpp"
+#include "ReplicaSet.hpp"
+#include "Generic.hpp"
+#include "InstanceAccounting.hpp"
+#include "TypeId.hpp"
\ No newline at end of file
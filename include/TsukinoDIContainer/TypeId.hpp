@@ -0,0 +1,240 @@
+//-------------------------------------------------------------
+//! @file   TypeId.hpp
+//! @brief  依存性注入コンテナライブラリの型識別子定義（RTTI 不要）
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <cstring>      // std::strcmp
+#include <functional>   // std::hash
+#include <string_view>  // std::string_view
+#include <type_traits>  // std::remove_cv_t
+// RTTI が有効なビルドか（-fno-rtti / /GR- では 0）
+#ifndef TSUKINO_DI_HAS_RTTI
+#if defined(__cpp_rtti) || defined(_CPPRTTI) || defined(__GXX_RTTI)
+#define TSUKINO_DI_HAS_RTTI 1
+#else
+#define TSUKINO_DI_HAS_RTTI 0
+#endif
+#endif
+// 型識別子の比較方式（全ての翻訳単位で同じ値にすること）
+//   0 : 型ごとの静的記録のアドレスで比較（既定、最速）
+//   1 : コンパイル時に求めた型名のハッシュで比較（共有ライブラリ境界で記録が複製される環境向け）
+#ifndef TSUKINO_DI_TYPE_ID_HASHED
+#define TSUKINO_DI_TYPE_ID_HASHED 0
+#endif
+// std::type_index との相互変換を有効にする場合は 1（既定は RTTI が有効なら 1）
+// 有効時は Container::resolveByKey(const std::type_index&) で動的な型から解決できる
+#ifndef TSUKINO_DI_TYPE_INDEX
+#define TSUKINO_DI_TYPE_INDEX TSUKINO_DI_HAS_RTTI
+#endif
+#if TSUKINO_DI_TYPE_INDEX
+#if !TSUKINO_DI_HAS_RTTI
+#error "TSUKINO_DI_TYPE_INDEX requires RTTI"
+#endif
+#include <typeindex>    // std::type_index
+#include <typeinfo>     // typeid
+#endif
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace detail {
+		//---------------------------------------------------------
+		//! @struct  TypeIdInfo
+		//! @brief   型 1 つ分の静的記録（コンパイル時に生成）
+		//---------------------------------------------------------
+		struct TypeIdInfo {
+			const char* name_;				// 型名（静的記憶域の文字列）
+			std::uint64_t hash_;			// 型名のハッシュ（FNV-1a）
+#if TSUKINO_DI_TYPE_INDEX
+			const std::type_info* info_;	// 処理系の型情報
+#endif
+		};
+
+		//---------------------------------------------------------
+		//! @brief  関数名に埋め込まれた型名を含む文字列を取得
+		//---------------------------------------------------------
+		template<typename T>
+		constexpr std::string_view rawTypeName() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+			return __FUNCSIG__;
+#else
+			return __PRETTY_FUNCTION__;
+#endif
+		}
+
+		// 型名の前後に付く文字数（void で調べる）
+		constexpr std::size_t kTypeNamePrefix = rawTypeName<void>().find("void");
+		constexpr std::size_t kTypeNameSuffix = rawTypeName<void>().size() - kTypeNamePrefix - 4;
+
+		//---------------------------------------------------------
+		//! @struct  TypeNameBuffer
+		//! @brief   整形済みの型名（終端文字付き）
+		//---------------------------------------------------------
+		template<std::size_t N>
+		struct TypeNameBuffer {
+			char chars_[N + 1] = {};
+		};
+
+		//---------------------------------------------------------
+		//! @brief  識別子に使える文字か
+		//---------------------------------------------------------
+		constexpr bool isIdentifierChar(char c) noexcept {
+			return c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+		}
+
+		//---------------------------------------------------------
+		//! @brief  型名を整形して複製（MSVC の "struct " / "class " などは除く）
+		//---------------------------------------------------------
+		template<std::size_t N>
+		constexpr TypeNameBuffer<N> makeTypeName(std::string_view raw) noexcept {
+			TypeNameBuffer<N> buffer{};
+			std::size_t out = 0;
+			for (std::size_t i = 0; i < raw.size();) {
+#if defined(_MSC_VER) && !defined(__clang__)
+				if (i == 0 || !isIdentifierChar(raw[i - 1])) {
+					const std::string_view keywords[] = { "struct ", "class ", "enum ", "union " };
+					bool skipped = false;
+					for (std::string_view keyword : keywords) {
+						if (raw.substr(i, keyword.size()) == keyword) {
+							i += keyword.size();
+							skipped = true;
+							break;
+						}
+					}
+					if (skipped) continue;
+				}
+#endif
+				buffer.chars_[out++] = raw[i++];
+			}
+			return buffer;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  終端文字までの FNV-1a ハッシュ
+		//---------------------------------------------------------
+		constexpr std::uint64_t hashTypeName(const char* name) noexcept {
+			std::uint64_t hash = 14695981039346656037ull;
+			for (; *name; ++name) {
+				hash = (hash ^ static_cast<unsigned char>(*name)) * 1099511628211ull;
+			}
+			return hash;
+		}
+
+		//---------------------------------------------------------
+		//! @struct  TypeIdRecord
+		//! @brief   型ごとの静的記録
+		//! @tparam  T  型
+		//---------------------------------------------------------
+		template<typename T>
+		struct TypeIdRecord {
+			static constexpr std::string_view kRaw = rawTypeName<T>().substr(kTypeNamePrefix, rawTypeName<T>().size() - kTypeNamePrefix - kTypeNameSuffix);
+			static constexpr TypeNameBuffer<kRaw.size()> kName = makeTypeName<kRaw.size()>(kRaw);
+#if TSUKINO_DI_TYPE_INDEX
+			static constexpr TypeIdInfo kInfo{ kName.chars_, hashTypeName(kName.chars_), &typeid(T) };
+#else
+			static constexpr TypeIdInfo kInfo{ kName.chars_, hashTypeName(kName.chars_) };
+#endif
+		};
+	}
+
+	//-------------------------------------------------------------
+	//! @class  TypeId
+	//! @brief  型識別子（コンテナのキー）
+	//! @details typeId<T>() でコンパイル時に生成する。RTTI を使わず、型名もコンパイル時に求める。
+	//!          比較は TSUKINO_DI_TYPE_ID_HASHED に従い、静的記録のアドレスまたは型名のハッシュで行う。
+	//!          定数式での比較はハッシュ比較の設定でのみ保証する（異なる静的記録のアドレス比較は、
+	//!          サニタイザ有効時の GCC などで定数式にならない）。name() / hash_code() は常に定数式で使える。
+	//!          ポインタ 1 つ分の値で、コピーは軽量。
+	//-------------------------------------------------------------
+	class TypeId {
+	public:
+		//---------------------------------------------------------
+		// コンストラクタ（void を表す）
+		//---------------------------------------------------------
+		constexpr TypeId() noexcept : info_(&detail::TypeIdRecord<void>::kInfo) {}
+
+		//---------------------------------------------------------
+		// コンストラクタ
+		//! @param  info  [in] 型の静的記録
+		//---------------------------------------------------------
+		constexpr explicit TypeId(const detail::TypeIdInfo& info) noexcept : info_(&info) {}
+
+		//---------------------------------------------------------
+		// 型名を取得
+		//! @return 読みやすい型名（静的記憶域の文字列、例: "MyApp::Service"）
+		//---------------------------------------------------------
+		constexpr const char* name() const noexcept { return info_->name_; }
+
+		//---------------------------------------------------------
+		// ハッシュ値を取得
+		//! @return 型名のハッシュ（コンパイル時に計算済み）
+		//---------------------------------------------------------
+		constexpr std::size_t hash_code() const noexcept { return static_cast<std::size_t>(info_->hash_); }
+
+#if TSUKINO_DI_TYPE_INDEX
+		//---------------------------------------------------------
+		// std::type_index へ変換
+		//! @return 同じ型の type_index
+		//---------------------------------------------------------
+		std::type_index typeIndex() const noexcept { return std::type_index(*info_->info_); }
+
+		//---------------------------------------------------------
+		// std::type_index から型識別子を検索
+		//! @param  type  [in]  動的に得た型
+		//! @param  id    [out] 見つかった型識別子
+		//! @return コンテナに登録（またはモジュールが公開）されたことのある型なら true
+		//---------------------------------------------------------
+		static bool fromTypeIndex(const std::type_index& type, TypeId& id);
+#endif
+
+		// 等価比較（定数式で使えるのは TSUKINO_DI_TYPE_ID_HASHED が 1 の場合のみ）
+		friend constexpr bool operator==(const TypeId& a, const TypeId& b) noexcept {
+#if TSUKINO_DI_TYPE_ID_HASHED
+			return a.info_->hash_ == b.info_->hash_;
+#else
+			return a.info_ == b.info_;
+#endif
+		}
+		friend constexpr bool operator!=(const TypeId& a, const TypeId& b) noexcept { return !(a == b); }
+		// 型名順（エラーメッセージなどの並びを処理系やビルドによらず固定する）
+		friend bool operator<(const TypeId& a, const TypeId& b) noexcept {
+			return a != b && std::strcmp(a.name(), b.name()) < 0;
+		}
+
+	private:
+		const detail::TypeIdInfo* info_;	// 型の静的記録
+	};
+
+	//-------------------------------------------------------------
+	// 型識別子を取得
+	//! @tparam T  型（const / volatile は無視する）
+	//! @return 型識別子
+	//-------------------------------------------------------------
+	template<typename T>
+	constexpr TypeId typeId() noexcept {
+		return TypeId(detail::TypeIdRecord<std::remove_cv_t<T>>::kInfo);
+	}
+
+	namespace detail {
+#if TSUKINO_DI_TYPE_INDEX
+		//---------------------------------------------------------
+		// TypeId::fromTypeIndex で検索できるよう型識別子を公開
+		//! @param  id  [in] 型識別子
+		//---------------------------------------------------------
+		void publishTypeId(const TypeId& id);
+#else
+		inline void publishTypeId(const TypeId&) noexcept {}
+#endif
+	}
+}// namespace TsukinoDIContainer
+
+//-------------------------------------------------------------
+//! @brief  TypeId のハッシュ（unordered_map のキー用）
+//-------------------------------------------------------------
+namespace std {
+	template<>
+	struct hash<TsukinoDIContainer::TypeId> {
+		std::size_t operator()(const TsukinoDIContainer::TypeId& id) const noexcept { return id.hash_code(); }
+	};
+}
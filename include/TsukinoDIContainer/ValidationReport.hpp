@@ -0,0 +1,58 @@
+//-------------------------------------------------------------
+//! @file   ValidationReport.hpp
+//! @brief  依存性注入コンテナライブラリの検証結果定義
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#pragma once
+#include <string>     // std::string
+#include <vector>     // std::vector
+#include "TypeId.hpp" // TypeId
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @enum   ValidationIssueKind
+	//! @brief  検証で検出された問題の種類
+	//-------------------------------------------------------------
+	enum class ValidationIssueKind {
+		MissingDependency,	//!< 依存先が未登録
+		CircularDependency,	//!< 循環依存
+		CaptiveDependency,	//!< 長寿命の型が Scoped / PerThread / Cached / Replicated を保持してしまう依存
+		DanglingReference	//!< Singleton 以外の依存を参照で受け取る（構築後に参照先が破棄されうる）
+	};
+
+	//-------------------------------------------------------------
+	//! @struct  ValidationIssue
+	//! @brief   検証で検出された問題 1 件
+	//-------------------------------------------------------------
+	struct ValidationIssue {
+		ValidationIssueKind kind_ = ValidationIssueKind::MissingDependency;	// 問題の種類
+		std::vector<TypeId> path_;									// 問題となる依存の経路（依存する側から順）
+		std::string message_;												// エラーメッセージ
+	};
+
+	//-------------------------------------------------------------
+	//! @struct  ValidationReport
+	//! @brief   Container::validate の検証結果
+	//-------------------------------------------------------------
+	struct ValidationReport {
+		std::vector<ValidationIssue> issues_;	// 検出された全ての問題
+
+		//---------------------------------------------------------
+		// 問題がないか確認
+		//! @return 問題がなければ true
+		//---------------------------------------------------------
+		bool ok() const { return issues_.empty(); }
+
+		//---------------------------------------------------------
+		// 全ての問題を 1 行ずつ並べた文字列を取得
+		//! @return レポート文字列（問題がなければ空）
+		//---------------------------------------------------------
+		std::string toString() const;
+
+		//---------------------------------------------------------
+		// 問題があれば例外を投げる
+		//! @throws ResolveException 問題が 1 件以上ある場合（全件をメッセージに含む）
+		//---------------------------------------------------------
+		void throwIfFailed() const;
+	};
+}// namespace TsukinoDIContainer
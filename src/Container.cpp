@@ -1,7 +1,7 @@
 //-------------------------------------------------------------
 //! @file   Container.cpp
-//! @brief  ˑReiCũRei
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリのコンテナ実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include "TsukinoDIContainer/Container.hpp"
 #include "TsukinoDIContainer/ResolveException.hpp"
@@ -9,67 +9,1515 @@
 #include "TsukinoDIContainer/Lifecycle.hpp"
 #include "TsukinoDIContainer/ResolvingGuardTL.hpp"
 #include "TsukinoDIContainer/ResolvingStack.hpp"
-// O : TsukinoDIContainer
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer
 {
 	//-------------------------------------------------------------
-	//! @brief ^ł̓wp[
+	//! @brief 静的メンバ定義
 	//-------------------------------------------------------------
-	std::shared_ptr<void> Container::resolveByKey(const std::type_index& key) {
-		// o^mF
+	thread_local std::array<Container::ResolveCacheSlot, Container::kResolveCacheSlots> Container::tl_resolve_cache_;
+	std::atomic<std::uint64_t> Container::resolve_cache_epoch_{ 1 };
+
+	namespace {
+		//---------------------------------------------------------
+		//! @struct  BulkBlock
+		//! @brief   resolveN で一括構築したインスタンスの連続領域（制御ブロックは全件で 1 つ）
+		//---------------------------------------------------------
+		struct BulkBlock {
+			BulkBlock(PlaceFn place, std::size_t stride, std::size_t align, std::size_t count)
+				: place_(place), stride_(stride), align_(align) {
+				if (count > std::numeric_limits<std::size_t>::max() / stride) {
+					throw std::bad_alloc();
+				}
+				storage_ = static_cast<unsigned char*>(::operator new(stride * count, std::align_val_t(align)));
+			}
+			~BulkBlock() {
+				// 構築済みの分だけ逆順に破棄
+				while (constructed_ > 0) {
+					--constructed_;
+					place_(storage_ + stride_ * constructed_, nullptr);
+				}
+				::operator delete(storage_, std::align_val_t(align_));
+			}
+			BulkBlock(const BulkBlock&) = delete;
+			BulkBlock& operator=(const BulkBlock&) = delete;
+
+			//! @brief 次の位置に構築（抽象型を指すポインタを返す）
+			void* emplace(const std::vector<std::shared_ptr<void>>& args) {
+				void* created = place_(storage_ + stride_ * constructed_, &args);
+				++constructed_;
+				return created;
+			}
+
+			PlaceFn place_;					// 配置構築関数
+			std::size_t stride_;			// 1 件あたりのバイト数
+			std::size_t align_;				// アライメント
+			unsigned char* storage_ = nullptr;	// 連続領域
+			std::size_t constructed_ = 0;	// 構築済みの件数
+		};
+
+		//---------------------------------------------------------
+		//! @struct  LoadingModule
+		//! @brief   呼び出しスレッドが読み込み中のモジュール
+		//---------------------------------------------------------
+		struct LoadingModule {
+			const Container* container_;	// 読み込み先のコンテナ
+			const void* module_;			// 読み込み中のモジュール（再入検出用）
+			std::vector<TypeId> added_;		// configure が追加した登録（失敗時に取り消す）
+		};
+		thread_local std::vector<LoadingModule> tl_loading_modules;	// 読み込み中のモジュール（内側ほど後ろ）
+
+		//! @brief 読み込み中のモジュールの configure による追加を記録
+		void noteModuleAdded(const Container* container, const TypeId& type) {
+			if (!tl_loading_modules.empty() && tl_loading_modules.back().container_ == container) {
+				tl_loading_modules.back().added_.push_back(type);
+			}
+		}
+
+		//! @brief 呼び出しスレッドがモジュールを読み込み中か確認
+		bool isLoadingModule(const void* module) {
+			return std::any_of(tl_loading_modules.begin(), tl_loading_modules.end(),
+				[module](const LoadingModule& loading) { return loading.module_ == module; });
+		}
+
+		//! @brief 呼び出しスレッドがコンテナのモジュールを読み込み中か確認
+		bool isLoadingInto(const Container* container) {
+			return std::any_of(tl_loading_modules.begin(), tl_loading_modules.end(),
+				[container](const LoadingModule& loading) { return loading.container_ == container; });
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief デストラクタ
+	//-------------------------------------------------------------
+	Container::~Container() {
+		// 他スレッドのキャッシュはエポック不一致で無効になる
+		invalidateResolveCache();
+		// 呼び出しスレッドのキャッシュはここで解放しておく
+		for (auto& slot : tl_resolve_cache_) {
+			if (slot.owner_ == this) {
+				slot = ResolveCacheSlot{};
+			}
+		}
+		// 親の登録の変更を再び許可する（親の保持は parent_ の破棄で解放）
+		if (parent_) {
+			parent_->live_forks_.fetch_sub(1, std::memory_order_acq_rel);
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型消去での内部解決ヘルパー
+	//-------------------------------------------------------------
+	std::shared_ptr<void> Container::resolveByKey(const TypeId& key) {
+		return resolveImpl(key, nullptr);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Lazy<T> からの型解決
+	//-------------------------------------------------------------
+	std::shared_ptr<void> Container::resolveLazyByKey(const TypeId& key) {
+		return resolveImpl(key, nullptr, true);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief キーによる一括解決
+	//-------------------------------------------------------------
+	std::vector<std::shared_ptr<void>> Container::resolveNByKey(const TypeId& key, std::size_t count) {
+		std::vector<std::shared_ptr<void>> result;
+		if (count == 0) {
+			return result;
+		}
+		result.reserve(count);
+
+		// 登録の検索は 1 回（fork したコンテナは親の登録を使う）
+		auto reg = findOrLoadRegistration(key);
+		if (!reg) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, key);
+		}
+		// Transient 以外は寿命ごとの共有・再利用があるため 1 件ずつ解決
+		if (reg->cycle_ != Lifecycle::Transient || reg->async_) {
+			for (std::size_t i = 0; i < count; ++i) {
+				result.push_back(resolveImpl(key, nullptr));
+			}
+			return result;
+		}
+
+		// 解決トレース（有効時のみ、一括で 1 件として記録）
+		detail::TraceScope trace(tracing_enabled_.load(std::memory_order_relaxed) ? &key : nullptr, ResolveTrace::Category::Resolve);
+
+		// RAII ガードで push/pop を自動化（検証済みなら循環がないため省略、Lazy<T> からの解決の内側では省略しない）
+		std::optional<ResolvingGuardTL> guard;
+		if (!g_resolving_stack.empty() || !isValidated()) {
+			guard.emplace(key);
+		}
+
+		// 依存は 1 回だけ解決して全件で共有
+		std::vector<std::shared_ptr<void>> args;
+		args.reserve(reg->deps_.size());
+		for (auto& depKey : reg->deps_) {
+			args.push_back(resolveImpl(depKey, nullptr));
+		}
+
+#if !TSUKINO_DI_INSTANCE_ACCOUNTING
+		// 連続領域に一括構築
+		if (reg->bulk_.place_) {
+			checkReferenceDeps(key, *reg);
+			constructBulk(*reg, args, count, result);
+			return result;
+		}
+#endif
+		// ファクトリ登録などは 1 件ずつ構築（計上有効時はインスタンスごとに包むためこちら）
+		for (std::size_t i = 0; i < count; ++i) {
+			result.push_back(construct(key, *reg, args));
+		}
+		return result;
+	}
+
+#if TSUKINO_DI_TYPE_INDEX
+	//-------------------------------------------------------------
+	//! @brief 動的に得た型による型解決
+	//-------------------------------------------------------------
+	std::shared_ptr<void> Container::resolveByKey(const std::type_index& type) {
+		TypeId key;
+		if (!TypeId::fromTypeIndex(type, key)) {
+			// 一度も登録されていない型は TypeId を持たないため名前のみで報告
+			throw ResolveException("Type not registered: " + typeName(type.name()));
+		}
+		return resolveImpl(key, nullptr);
+	}
+#endif
+
+	//-------------------------------------------------------------
+	//! @brief キーによる型解決の本体
+	//-------------------------------------------------------------
+	std::shared_ptr<void> Container::resolveImpl(const TypeId& key, ResolveError* error, bool lazy, const GenericUse* generic) {
+		// 解決トレース（有効時のみ、戻り時に終了を記録）
+		detail::TraceScope trace(tracing_enabled_.load(std::memory_order_relaxed) ? &key : nullptr, ResolveTrace::Category::Resolve);
+
+		// スレッドローカル解決キャッシュ（有効時のみ）
+		ResolveCacheSlot* cache = nullptr;
+		std::uint64_t epoch = 0;
+		std::shared_ptr<const Registration> reg;
+		if (resolve_cache_enabled_.load(std::memory_order_relaxed)) {
+			// エポックは参照前に読む（途中で replace された場合は次回ミスになる）
+			epoch = resolve_cache_epoch_.load(std::memory_order_acquire);
+			cache = &tl_resolve_cache_[key.hash_code() & (kResolveCacheSlots - 1)];
+			if (cache->owner_ == this && cache->epoch_ == epoch && cache->key_ == key) {
+				if (cache->singleton_) {
+					return cache->singleton_; // 定常状態はここで終わる
+				}
+				// 未生成の Singleton は他スレッドの生成結果を確認するため通常経路へ
+				if (cache->plan_->cycle_ != Lifecycle::Singleton) {
+					reg = cache->plan_;
+				}
+			}
+		}
+
+		Shard& shard = shardFor(key);	// 対象型のシャード（他の型のシャードには触れない）
+
+		// 登録確認・登録情報スナップショット・既存 Singleton の確認を 1 回のロックで行う
+		if (!reg) {
+			auto lock = lockShared(shard, LockSite::ResolveLookup);
+			auto found = shard.registrations_.find(key);
+			if (found != shard.registrations_.end()) {
+				reg = found->second;
+
+				// 既に Singleton があれば返す（構築済みなので循環検出は不要）
+				if (reg->cycle_ == Lifecycle::Singleton) {
+					auto it = shard.singletons_.find(key);
+					if (it != shard.singletons_.end() && it->second) {
+						if (cache) {
+							*cache = ResolveCacheSlot{ this, key, epoch, reg, it->second };
+						}
+						return it->second;
+					}
+				}
+			}
+			else {
+				// オープンジェネリックの型は、このコンテナのテンプレートがあれば要求を記録（親のインスタンスより優先）
+				lock.unlock();
+				bool noted = false;
+				if (generic && has_generics_.load(std::memory_order_acquire)) {
+					noteGenericUse(generic->genericKey_, key, generic->materialize_);
+					noted = true;
+				}
+				// 未読み込みのモジュールが公開していれば読み込んでやり直す
+				if (loadModuleFor(key)) {
+					return resolveImpl(key, error, lazy);
+				}
+				// fork したコンテナは親の登録を継承する
+				if (parent_) {
+					reg = parent_->findOrLoadRegistration(key);
+					// 共有される寿命のインスタンスは親が保持する（子ごとに複製しない）
+					if (reg && isShared(reg->cycle_)) {
+						auto instance = parent_->resolveImpl(key, error, lazy);
+						if (cache && instance && reg->cycle_ == Lifecycle::Singleton) {
+							*cache = ResolveCacheSlot{ this, key, epoch, reg, instance };
+						}
+						return instance;
+					}
+				}
+				if (!reg) {
+					// オープンジェネリックの型は未登録の場合のみ要求を記録して解決し直す（インスタンス化後はここに来ない）
+					if (generic && !noted) {
+						noteGenericUse(generic->genericKey_, key, generic->materialize_);
+						return resolveImpl(key, error, lazy);
+					}
+					if (error) {
+						*error = ResolveError{ ResolveErrorCode::NotRegistered, key };
+						return nullptr;
+					}
+					throw ResolveException(ResolveErrorCode::NotRegistered, key);
+				}
+				// Transient / Scoped は子で構築する（子で差し替えた依存を反映する）
+			}
+			if (cache) {
+				*cache = ResolveCacheSlot{ this, key, epoch, reg, nullptr };
+			}
+		}
+
+		// PerThread は呼び出しスレッドのインスタンスがあれば返す（ロックなし）
+		if (reg->perThread_) {
+			if (const auto* existing = reg->perThread_->get()) {
+				if (cache) {
+					*cache = ResolveCacheSlot{ this, key, epoch, reg, *existing };
+				}
+				return *existing;
+			}
+		}
+
+		// Pooled はプールに空きがあれば依存の解決も構築も行わない
+		if (reg->pool_) {
+			if (auto pooled = reg->pool_->tryAcquire()) {
+				return pooled;
+			}
+		}
+
+		// Cached は保持中（期限内）のインスタンスがあれば返す
+		if (reg->cycle_ == Lifecycle::Cached) {
+			if (auto cached = instance_cache_.get(key, reg.get())) {
+				return cached;
+			}
+		}
+
+		// Replicated は呼び出しスレッドのノードのレプリカがあれば返す（世代は構築前に読む）
+		const std::uint64_t replicaGeneration = reg->replicas_ ? reg->replicas_->generation() : 0;
+		if (reg->replicas_) {
+			if (auto replica = reg->replicas_->get(replicaGeneration)) {
+				return replica;
+			}
+		}
+
+		// RAII ガードで push/pop を自動化（検証済みなら循環がないため省略）
+		// Lazy<T> の辺は検証されないため、Lazy<T> からの解決とその内側では省略しない（連鎖全体を報告する）
+		std::optional<ResolvingGuardTL> guard;
+		if (lazy || !g_resolving_stack.empty() || !isValidated()) {
+			if (!error) {
+				guard.emplace(key);
+			}
+			else if (!guard.emplace(key, std::nothrow).active_) {
+				*error = ResolveError{ ResolveErrorCode::CircularDependency, key };
+				return nullptr;
+			}
+		}
+
+		// 非同期ファクトリの型は同期解決できない（例外版は ctor_ が投げる）
+		if (error && reg->async_) {
+			*error = ResolveError{ ResolveErrorCode::AsyncOnly, key };
+			return nullptr;
+		}
+
+		// 依存を再帰的に解決
+		std::vector<std::shared_ptr<void>> args;
+		args.reserve(reg->deps_.size());
+		for (auto& depKey : reg->deps_) {
+			args.push_back(resolveImpl(depKey, error));
+			if (error && error->code_ != ResolveErrorCode::None) {
+				return nullptr; // 依存先の失敗をそのまま返す
+			}
+		}
+
+		// 構築
+		std::shared_ptr<void> created = construct(key, *reg, args);
+
+		// Singleton の場合はキャッシュに保存
+		if (reg->cycle_ == Lifecycle::Singleton) {
+			std::shared_ptr<void> result;
+			{
+				auto lock = lockExclusive(shard, LockSite::SingletonStore);
+				auto& slot = shard.singletons_[key];
+				if (!slot) slot = created;
+				result = slot;
+			}
+			if (cache) {
+				// 依存解決中に同じスロットが上書きされている可能性があるため再設定
+				*cache = ResolveCacheSlot{ this, key, epoch, reg, result };
+			}
+			return result; // guard が自動で pop
+		}
+
+		// Cached は保持して返す（他スレッドが先に保持していればそちらを返す）
+		if (reg->cycle_ == Lifecycle::Cached) {
+			const std::size_t bytes = reg->size_ ? reg->size_(created.get()) : 0;
+			return instance_cache_.put(key, reg.get(), std::move(created), bytes);
+		}
+
+		// Replicated は呼び出しスレッドのノードに保存（構築中に更新された場合は保存しない）
+		if (reg->replicas_) {
+			return reg->replicas_->set(replicaGeneration, std::move(created));
+		}
+
+		// Pooled は返却時にプールへ戻るハンドルを返す
+		if (reg->pool_) {
+			return reg->pool_->adopt(std::move(created));
+		}
+
+		// PerThread は呼び出しスレッドに保存（解決キャッシュもスレッドローカルのため保持してよい）
+		if (reg->perThread_) {
+			reg->perThread_->set(created);
+			if (cache) {
+				*cache = ResolveCacheSlot{ this, key, epoch, reg, created };
+			}
+			return created;
+		}
+
+		// Scoped / Transient はそのまま返す
+		return created; // guard が自動で pop
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録情報を確定（Pooled / PerThread / Replicated の場合は格納先を生成）
+	//-------------------------------------------------------------
+	std::shared_ptr<const Container::Registration> Container::makeRegistration(Registration reg, ObjectPool::ResetFn reset, InstanceCache::SizeFn size) {
+		reg.size_ = size;
+		if (reg.cycle_ == Lifecycle::Pooled) {
+			reg.pool_ = std::make_shared<ObjectPool>(reset);
+		}
+		if (reg.cycle_ == Lifecycle::PerThread) {
+			reg.perThread_ = std::make_shared<PerThreadSlot>();
+		}
+		if (reg.cycle_ == Lifecycle::Replicated) {
+			reg.replicas_ = std::make_shared<ReplicaSet>();
+		}
+		return std::make_shared<const Registration>(std::move(reg));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録情報を登録表へ追加
+	//-------------------------------------------------------------
+	void Container::addRegistration(const TypeId& type, std::shared_ptr<const Registration> reg, bool replace) {
+		checkNotForked();
+		detail::publishTypeId(type);
+		if (replace) {
+			loadModuleFor(type);	// 未読み込みのモジュールが公開する型は読み込んでから上書き
+		}
+		reg = planRegistration(type, std::move(reg));	// コンテキスト束縛を適用（ロック外）
+		Shard& shard = shardFor(type);
+		auto lock = lockExclusive(shard, LockSite::Register); // スレッドセーフ（該当シャードのみ）
+		if (!replace) {
+			// 未読み込みのモジュールが公開する型は、読み込み時の登録と重複するため拒否
+			if (isReservedByModule(type)) {
+				throw ResolveException(ResolveErrorCode::AlreadyRegistered, type);
+			}
+			// 登録済み確認と登録処理（ハッシュ計算は 1 回）
+			if (!shard.registrations_.try_emplace(type, std::move(reg)).second) {
+				// 既に登録済みなら例外、上書きしたい場合はReplaceを使用させる。
+				throw ResolveException(ResolveErrorCode::AlreadyRegistered, type);
+			}
+			noteModuleAdded(this, type);
+		}
+		else {
+			shard.registrations_[type] = std::move(reg);
+			// 旧 Singleton / Cached を必ず破棄（次回解決で新規生成）
+			shard.singletons_.erase(type);
+			instance_cache_.erase(type);
+		}
+		// 検証済み状態の解除と解決キャッシュの無効化（追加のみでも fork 元の登録を隠すため必要）
+		markRegistrationsChanged();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型ごとの記述子から登録
+	//-------------------------------------------------------------
+	void Container::registerDescriptor(const StaticRegistration& descriptor, bool replace) {
+		// オープンジェネリックの依存はここで要求を記録
+		if (descriptor.generics_) {
+			descriptor.generics_(*this);
+		}
+		// 登録情報はロック外で生成
+		std::vector<TypeId> deps;
+		deps.reserve(descriptor.depCount_);
+		for (std::size_t i = 0; i < descriptor.depCount_; ++i) {
+			deps.push_back(descriptor.deps_[i]);
+		}
+		Registration base{ descriptor.cycle_, std::move(deps), descriptor.factory_ };
+		base.bulk_ = descriptor.bulk_;
+		base.refDeps_ = descriptor.refDeps_;
+		auto reg = makeRegistration(std::move(base), descriptor.reset_, descriptor.size_);
+		addRegistration(descriptor.type_, std::move(reg), replace);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief インスタンス登録の本体
+	//-------------------------------------------------------------
+	void Container::registerInstanceImpl(const TypeId& type, std::shared_ptr<void> instance, bool replace) {
+		checkNotForked();
+		detail::publishTypeId(type);
+		// 登録情報はロック外で生成
+		auto reg = makeRegistration(Registration{
+			Lifecycle::Singleton,														// ライフサイクル
+			{},																			// 依存なし
+			[instance](const std::vector<std::shared_ptr<void>>&) { return instance; }	// ファクトリ関数
+		});
+		if (replace) {
+			loadModuleFor(type);	// 未読み込みのモジュールが公開する型は読み込んでから上書き
+		}
+		Shard& shard = shardFor(type);
+		auto lock = lockExclusive(shard, LockSite::Register); // スレッドセーフ（該当シャードのみ）
+		if (!replace) {
+			if (isReservedByModule(type) || !shard.registrations_.try_emplace(type, std::move(reg)).second) {
+				throw ResolveException(ResolveErrorCode::AlreadyRegistered, type);
+			}
+			noteModuleAdded(this, type);
+		}
+		else {
+			shard.registrations_[type] = std::move(reg);
+			instance_cache_.erase(type);
+		}
+		shard.singletons_[type] = std::move(instance);  // シングルトンインスタンスとして保存
+		// 検証済み状態の解除と解決キャッシュの無効化
+		markRegistrationsChanged();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型が登録済みか確認
+	//-------------------------------------------------------------
+	bool Container::isRegisteredByKey(const TypeId& type) const {
+		const Shard& shard = shardFor(type);
 		{
-			std::shared_lock<std::shared_mutex> lock(mutex_);
-			if (registrations_.find(key) == registrations_.end()) {
-				throw ResolveException("Type not registered: " + std::string(key.name()));
+			auto lock = lockShared(shard, LockSite::IsRegistered); // 読み取り専用ロック（該当シャードのみ）
+			// 登録情報マップに存在するか確認
+			if (shard.registrations_.find(type) != shard.registrations_.end()) {
+				return true;
 			}
 		}
+		return isExportedByPendingModule(type) || (parent_ && parent_->isRegisteredByKey(type));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 一括登録
+	//-------------------------------------------------------------
+	void Container::registerBatch(RegistrationBatch batch) {
+		auto& entries = batch.entries_;
+		if (entries.empty()) {
+			return;
+		}
+		checkNotForked();
 
-		// RAII K[h push/pop 
-		ResolvingGuardTL guard(key);
+		//---------------------------------------------------------
+		//! @struct  Pending
+		//! @brief   挿入待ちの登録 1 件
+		//---------------------------------------------------------
+		struct Pending {
+			TypeId type_;						// 抽象型インターフェース
+			std::shared_ptr<const Registration> reg_;	// 確定済みの登録情報
+			std::shared_ptr<void> instance_;			// 登録済みインスタンス
+		};
 
-		// o^XibvVbg
-		Registration reg_copy;
+		// 登録情報の生成とシャードごとの振り分け（ロック外）
+		std::array<std::vector<Pending>, kShardCount> pending;
 		{
-			std::shared_lock<std::shared_mutex> lock(mutex_);
-			reg_copy = registrations_.at(key);
+			std::array<std::size_t, kShardCount> counts{};
+			for (const auto& entry : entries) {
+				++counts[shardIndex(entry.type_)];
+			}
+			for (std::size_t i = 0; i < kShardCount; ++i) {
+				pending[i].reserve(counts[i]);
+			}
+		}
+		for (auto& entry : entries) {
+			Registration base{ entry.cycle_, std::move(entry.deps_), std::move(entry.ctor_) };
+			base.bulk_ = entry.bulk_;
+			base.refDeps_ = entry.refDeps_;
+			pending[shardIndex(entry.type_)].push_back(Pending{
+				entry.type_,
+				planRegistration(entry.type_, makeRegistration(std::move(base), entry.reset_, entry.size_)),
+				std::move(entry.instance_)
+			});
 		}
 
-		//  Singleton ΕԂ
-		if (reg_copy.cycle_ == Lifecycle::Singleton) {
-			std::shared_lock<std::shared_mutex> lock(mutex_);
-			auto it = singletons_.find(key);
-			if (it != singletons_.end() && it->second) {
-				return it->second; // guard  pop
+		// 対象シャードを番号順にロック（順序を固定してデッドロックを防ぐ）
+		std::array<ExclusiveLock, kShardCount> locks;
+		for (std::size_t i = 0; i < kShardCount; ++i) {
+			if (!pending[i].empty()) {
+				locks[i] = lockExclusive(shards_[i], LockSite::Register);
 			}
 		}
 
-		// ˑċAIɉ
-		std::vector<std::shared_ptr<void>> args;
-		args.reserve(reg_copy.deps_.size());
-		for (auto& depKey : reg_copy.deps_) {
-			args.push_back(resolveByKey(depKey));
+		// 容量を確保してから挿入（再ハッシュは最大 1 回、挿入ごとのハッシュ計算は 1 回）
+		// バッチ内の重複も既存との重複も挿入の失敗として 1 回の走査で検出する
+		std::vector<TypeId> duplicates;
+		for (std::size_t i = 0; i < kShardCount; ++i) {
+			auto& map = shards_[i].registrations_;
+			map.reserve(map.size() + pending[i].size());
+			for (auto& item : pending[i]) {
+				// 未読み込みのモジュールが公開する型も重複として扱う
+				if (isReservedByModule(item.type_)) {
+					duplicates.push_back(item.type_);
+					continue;
+				}
+				auto result = map.try_emplace(item.type_, item.reg_);
+				if (!result.second) {
+					duplicates.push_back(item.type_);
+				}
+			}
+		}
+
+		// 重複があれば挿入した分を取り消す（ロック中のため他スレッドからは見えない）
+		if (!duplicates.empty()) {
+			for (std::size_t i = 0; i < kShardCount; ++i) {
+				auto& map = shards_[i].registrations_;
+				for (const auto& item : pending[i]) {
+					auto it = map.find(item.type_);
+					if (it != map.end() && it->second == item.reg_) {
+						map.erase(it);
+					}
+				}
+			}
+			std::sort(duplicates.begin(), duplicates.end());
+			duplicates.erase(std::unique(duplicates.begin(), duplicates.end()), duplicates.end());
+			throw ResolveException(ResolveErrorCode::AlreadyRegistered, std::move(duplicates));
+		}
+
+		// シングルトンインスタンスとして保存
+		for (std::size_t i = 0; i < kShardCount; ++i) {
+			for (auto& item : pending[i]) {
+				if (item.instance_) {
+					shards_[i].singletons_[item.type_] = std::move(item.instance_);
+				}
+				noteModuleAdded(this, item.type_);
+			}
+		}
+
+		// 検証済み状態の解除と解決キャッシュの無効化
+		markRegistrationsChanged();
+
+		// オープンジェネリックの依存型を記録（シャードのロックを解放してから行う）
+		for (auto& lock : locks) {
+			if (lock.owns_lock()) lock.unlock();
+		}
+		for (const auto& entry : entries) {
+			detail::publishTypeId(entry.type_);
+			if (entry.generics_) {
+				entry.generics_(*this);
+			}
 		}
+	}
 
-		// \z
-		std::shared_ptr<void> created = reg_copy.ctor_(args);
+	//-------------------------------------------------------------
+	//! @brief ファクトリを呼び出してインスタンスを構築
+	//-------------------------------------------------------------
+	std::shared_ptr<void> Container::construct(const TypeId& key, const Registration& reg, const std::vector<std::shared_ptr<void>>& args) const {
+		checkReferenceDeps(key, reg);
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+		// 計上有効時は構築したインスタンスを包む（破棄時に減算）
+		const auto track = [&key, &reg](std::shared_ptr<void> created) {
+			const std::size_t bytes = reg.size_ && created ? reg.size_(created.get()) : 0;
+			return detail::trackInstance(key, reg.cycle_, std::move(created), bytes, reg.accounting_);
+		};
+#else
+		(void)key;
+		const auto track = [](std::shared_ptr<void> created) { return created; };
+#endif
+		// 計測無効時は分岐 1 つのみ
+		if (!construction_timing_enabled_.load(std::memory_order_relaxed)) {
+			return track(reg.ctor_(args));
+		}
+		const auto begin = std::chrono::steady_clock::now();
+		std::shared_ptr<void> created = reg.ctor_(args);
+		const auto elapsed = std::chrono::steady_clock::now() - begin;
+		reg.stats_->record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+		return track(std::move(created));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 連続領域に count 件を配置構築
+	//-------------------------------------------------------------
+	void Container::constructBulk(const Registration& reg, const std::vector<std::shared_ptr<void>>& args, std::size_t count, std::vector<std::shared_ptr<void>>& result) const {
+		// 確保は制御ブロック（BulkBlock を含む）と連続領域の 2 回のみ
+		auto block = std::make_shared<BulkBlock>(reg.bulk_.place_, reg.bulk_.size_, reg.bulk_.align_, count);
+		const bool timing = construction_timing_enabled_.load(std::memory_order_relaxed);
+		for (std::size_t i = 0; i < count; ++i) {
+			// 途中で例外が出た場合は構築済みの分を block が破棄する
+			if (!timing) {
+				result.push_back(std::shared_ptr<void>(block, block->emplace(args)));
+				continue;
+			}
+			const auto begin = std::chrono::steady_clock::now();
+			void* created = block->emplace(args);
+			const auto elapsed = std::chrono::steady_clock::now() - begin;
+			reg.stats_->record(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+			result.push_back(std::shared_ptr<void>(block, created));
+		}
+	}
 
-		// Singleton ̏ꍇ̓LbVɕۑ
-		if (reg_copy.cycle_ == Lifecycle::Singleton) {
-			std::unique_lock<std::shared_mutex> lock(mutex_);
-			auto& slot = singletons_[key];
-			if (!slot) slot = created;
-			return slot; // guard  pop
+	//-------------------------------------------------------------
+	//! @brief 参照で受け取る依存が Singleton か確認
+	//-------------------------------------------------------------
+	void Container::checkReferenceDeps(const TypeId& key, const Registration& reg) const {
+		// 参照の引数がない、または検証済み（validate で確認済み）なら分岐 1 つのみ
+		if (!reg.refDeps_ || isValidated()) {
+			return;
+		}
+		for (std::size_t i = 0; i < reg.deps_.size(); ++i) {
+			if (!(reg.refDeps_ & (std::uint32_t{ 1 } << i))) continue;
+			// fork したコンテナは親の登録を継承する
+			std::shared_ptr<const Registration> dep;
+			for (const Container* current = this; current && !dep; current = current->parent_.get()) {
+				dep = current->findRegistration(reg.deps_[i]);
+			}
+			if (dep && dep->cycle_ != Lifecycle::Singleton) {
+				throw ResolveException("Reference to a non-Singleton dependency would dangle: " + typeName(key)
+					+ " takes " + toString(dep->cycle_) + " " + typeName(reg.deps_[i]) + " by reference");
+			}
 		}
+	}
 
-		// Scoped / Transient ͂̂܂ܕԂ
-		return created; // guard  pop
+	//-------------------------------------------------------------
+	//! @brief 型キーに対応する登録情報を取得
+	//-------------------------------------------------------------
+	std::shared_ptr<const Container::Registration> Container::findRegistration(const TypeId& key) const {
+		const Shard& shard = shardFor(key);
+		auto lock = lockShared(shard, LockSite::Snapshot);
+		auto it = shard.registrations_.find(key);
+		return it != shard.registrations_.end() ? it->second : nullptr;
 	}
 
+	//-------------------------------------------------------------
+	//! @brief 型キーに対応する登録情報を取得（未登録ならモジュールを読み込んで再検索）
+	//-------------------------------------------------------------
+	std::shared_ptr<const Container::Registration> Container::findOrLoadRegistration(const TypeId& key) {
+		auto reg = findRegistration(key);
+		if (!reg && loadModuleFor(key)) {
+			reg = findRegistration(key);
+		}
+		// fork したコンテナは親の登録を継承する
+		if (!reg && parent_) {
+			reg = parent_->findOrLoadRegistration(key);
+		}
+		return reg;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief モジュール追加の本体
+	//-------------------------------------------------------------
+	void Container::addModuleImpl(ModuleConfigureFn configure, std::vector<TypeId> exports) {
+		checkNotForked();
+		// 登録済みの型との重複を確認（シャードのロックはモジュール表のロックより先に取る）
+		std::vector<TypeId> duplicates;
+		for (const auto& type : exports) {
+			if (findRegistration(type)) {
+				duplicates.push_back(type);
+			}
+		}
+
+		auto module = std::make_shared<PendingModule>();
+		module->configure_ = configure;
+		module->exports_ = std::move(exports);
+
+		std::lock_guard<std::mutex> lock(modules_mutex_);
+		// 他のモジュールが公開済みの型との重複を確認
+		for (const auto& type : module->exports_) {
+			if (pending_modules_.find(type) != pending_modules_.end()) {
+				duplicates.push_back(type);
+			}
+		}
+		if (!duplicates.empty()) {
+			throw ResolveException(ResolveErrorCode::AlreadyRegistered, std::move(duplicates));
+		}
+		for (const auto& type : module->exports_) {
+			pending_modules_.emplace(type, module);
+			detail::publishTypeId(type);
+		}
+		has_pending_modules_.store(true, std::memory_order_release);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型を公開している未読み込みのモジュールを読み込む
+	//-------------------------------------------------------------
+	bool Container::loadModuleFor(const TypeId& key) {
+		// モジュールを使わない場合は未登録時もここで終わる
+		if (!has_pending_modules_.load(std::memory_order_acquire)) {
+			return false;
+		}
+		std::shared_ptr<PendingModule> module;
+		{
+			std::lock_guard<std::mutex> lock(modules_mutex_);
+			auto it = pending_modules_.find(key);
+			if (it == pending_modules_.end()) {
+				return false;
+			}
+			module = it->second;
+		}
+		// configure 内から自モジュールの型を要求された場合は読み込まない（自身の読み込み完了を待つことになるため）
+		if (isLoadingModule(module.get())) {
+			return false;
+		}
+		// 同時に要求した他スレッドは読み込み完了まで待つ
+		// ※ configure の例外を通すため std::call_once は使わない（処理系によっては例外で待機者が停止する）
+		std::lock_guard<std::mutex> loadLock(module->mutex_);
+		if (module->loaded_) {
+			return true;
+		}
+		tl_loading_modules.push_back(LoadingModule{ this, module.get(), {} });
+		try {
+			module->configure_(*this);
+		}
+		catch (...) {
+			// 途中までの登録を取り消して未読み込みのまま残し、次の要求で再実行する
+			std::vector<TypeId> added = std::move(tl_loading_modules.back().added_);
+			tl_loading_modules.pop_back();
+			removeRegistrations(added);
+			throw;
+		}
+		tl_loading_modules.pop_back();
+		module->loaded_ = true;
+		// 公開表から外す
+		std::lock_guard<std::mutex> lock(modules_mutex_);
+		for (const auto& type : module->exports_) {
+			auto it = pending_modules_.find(type);
+			if (it != pending_modules_.end() && it->second == module) {
+				pending_modules_.erase(it);
+			}
+		}
+		has_pending_modules_.store(!pending_modules_.empty(), std::memory_order_release);
+		return true;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief オープンジェネリック登録
+	//-------------------------------------------------------------
+	void Container::registerGenericImpl(const TypeId& genericKey, Lifecycle cycle) {
+		checkNotForked();
+		{
+			std::lock_guard<std::mutex> lock(modules_mutex_);
+			if (!generics_.emplace(genericKey, cycle).second) {
+				throw ResolveException("Open generic is already registered: " + typeName(genericKey));
+			}
+			has_generics_.store(true, std::memory_order_release);
+			// 登録前に要求されていたインスタンスを未読み込みのモジュールとして公開
+			auto uses = generic_uses_.find(genericKey);
+			if (uses != generic_uses_.end()) {
+				for (const auto& use : uses->second) {
+					if (pending_modules_.find(use.first) == pending_modules_.end()) {
+						auto module = std::make_shared<PendingModule>();
+						module->configure_ = use.second;
+						module->exports_.push_back(use.first);
+						module->generic_ = true;
+						pending_modules_.emplace(use.first, std::move(module));
+					}
+				}
+				generic_uses_.erase(uses);
+				has_pending_modules_.store(!pending_modules_.empty(), std::memory_order_release);
+			}
+		}
+		// 検証済み状態の解除と解決キャッシュの無効化
+		markRegistrationsChanged();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief オープンジェネリックのインスタンスの要求を記録
+	//-------------------------------------------------------------
+	void Container::noteGenericUse(const TypeId& genericKey, const TypeId& type, ModuleConfigureFn materialize) {
+		// 登録済み（インスタンス化済み、または個別に登録）なら何もしない
+		if (findRegistration(type)) {
+			return;
+		}
+		bool registered = false;
+		{
+			std::lock_guard<std::mutex> lock(modules_mutex_);
+			registered = generics_.find(genericKey) != generics_.end();
+			if (registered) {
+				// 1 つの型だけを公開するモジュールとして扱う（初回の要求で 1 回だけ registerType される）
+				if (pending_modules_.find(type) == pending_modules_.end()) {
+					auto module = std::make_shared<PendingModule>();
+					module->configure_ = materialize;
+					module->exports_.push_back(type);
+					module->generic_ = true;
+					pending_modules_.emplace(type, std::move(module));
+					has_pending_modules_.store(true, std::memory_order_release);
+				}
+			}
+			else {
+				// registerGeneric より先に要求された場合は登録時に公開する
+				auto& uses = generic_uses_[genericKey];
+				const bool known = std::any_of(uses.begin(), uses.end(), [&type](const auto& use) { return use.first == type; });
+				if (!known) {
+					uses.emplace_back(type, materialize);
+				}
+			}
+		}
+		// fork したコンテナは親のオープンジェネリック登録も使う
+		if (!registered && parent_) {
+			parent_->noteGenericUse(genericKey, type, materialize);
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief オープンジェネリック登録のライフサイクルを取得
+	//-------------------------------------------------------------
+	bool Container::findGeneric(const TypeId& genericKey, Lifecycle& cycle) const {
+		std::lock_guard<std::mutex> lock(modules_mutex_);
+		auto it = generics_.find(genericKey);
+		if (it == generics_.end()) {
+			return false;
+		}
+		cycle = it->second;
+		return true;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief コンテキスト束縛を記録し、登録済みの消費側の依存型リストを置き換える
+	//-------------------------------------------------------------
+	void Container::registerContextualImpl(const TypeId& consumer, const TypeId& dependency, const TypeId& key) {
+		checkNotForked();
+		{
+			// 同じ辺の重複は置き換え先のキーの登録で検出済み
+			std::lock_guard<std::mutex> lock(modules_mutex_);
+			contextual_[consumer].emplace_back(dependency, key);
+			has_contextual_.store(true, std::memory_order_release);
+		}
+		// fork したコンテナで親の登録に束縛する場合は子の上書きとして登録する
+		std::shared_ptr<const Registration> inherited;
+		if (parent_ && !findRegistration(consumer)) {
+			inherited = parent_->findOrLoadRegistration(consumer);
+		}
+		Shard& shard = shardFor(consumer);
+		auto lock = lockExclusive(shard, LockSite::Register); // スレッドセーフ（該当シャードのみ）
+		auto found = shard.registrations_.find(consumer);
+		std::shared_ptr<const Registration> base;
+		if (found != shard.registrations_.end()) {
+			base = found->second;
+		}
+		else if (inherited) {
+			// プールなどの格納先は親と共有しない
+			Registration copy{ inherited->cycle_, inherited->deps_, inherited->ctor_, inherited->async_ };
+			copy.bulk_ = inherited->bulk_;
+			copy.refDeps_ = inherited->refDeps_;
+			base = makeRegistration(std::move(copy), nullptr, inherited->size_);
+		}
+		else {
+			return;	// 消費側の登録時に適用する
+		}
+		auto planned = planRegistration(consumer, base);
+		if (planned == base) {
+			return;	// 消費側が依存型を持たない
+		}
+		shard.registrations_[consumer] = std::move(planned);
+		// 検証済み状態の解除と解決キャッシュの無効化
+		markRegistrationsChanged();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 依存型リストにコンテキスト束縛を適用
+	//-------------------------------------------------------------
+	bool Container::applyContextual(const TypeId& consumer, std::vector<TypeId>& deps) const {
+		bool changed = false;
+		// 子から親の順に適用（置き換え済みの依存は親の束縛に一致しない）
+		for (const Container* current = this; current; current = current->parent_.get()) {
+			if (!current->has_contextual_.load(std::memory_order_acquire)) {
+				continue;
+			}
+			std::lock_guard<std::mutex> lock(current->modules_mutex_);
+			auto it = current->contextual_.find(consumer);
+			if (it == current->contextual_.end()) {
+				continue;
+			}
+			for (const auto& binding : it->second) {
+				for (auto& dep : deps) {
+					if (dep == binding.first) {
+						dep = binding.second;
+						changed = true;
+					}
+				}
+			}
+		}
+		return changed;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録情報にコンテキスト束縛を適用（解決計画の確定）
+	//-------------------------------------------------------------
+	std::shared_ptr<const Container::Registration> Container::planRegistration(const TypeId& consumer, std::shared_ptr<const Registration> reg) const {
+		if (!reg || reg->deps_.empty()) {
+			return reg;
+		}
+		std::vector<TypeId> deps = reg->deps_;
+		if (!applyContextual(consumer, deps)) {
+			return reg;
+		}
+		// 依存型リストだけを置き換えた複製（格納先や集計値は元の登録と共有）
+		auto planned = std::make_shared<Registration>(*reg);
+		planned->deps_ = std::move(deps);
+		return planned;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型を公開している未読み込みのモジュールがあるか確認
+	//-------------------------------------------------------------
+	bool Container::isExportedByPendingModule(const TypeId& key) const {
+		if (!has_pending_modules_.load(std::memory_order_acquire)) {
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(modules_mutex_);
+		return pending_modules_.find(key) != pending_modules_.end();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型が未読み込みのモジュールの公開する型として予約されているか確認
+	//-------------------------------------------------------------
+	bool Container::isReservedByModule(const TypeId& key) const {
+		if (!has_pending_modules_.load(std::memory_order_acquire)) {
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(modules_mutex_);
+		auto it = pending_modules_.find(key);
+		if (it == pending_modules_.end() || it->second->generic_) {
+			return false;
+		}
+		// configure 内から自モジュールの公開する型を登録する場合は許可
+		return !isLoadingModule(it->second.get());
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録を変更できるか確認
+	//-------------------------------------------------------------
+	void Container::checkNotForked() const {
+		// 親の登録の変更は全ての子の解決結果を黙って変えるため拒否する
+		// （子から要求されたモジュールやオープンジェネリックの読み込みは、公開済みの型の確定なので許可）
+		if (live_forks_.load(std::memory_order_acquire) != 0 && !isLoadingInto(this)) {
+			throw ResolveException("Registrations cannot be changed while forked child containers are alive");
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録を取り消す
+	//-------------------------------------------------------------
+	void Container::removeRegistrations(const std::vector<TypeId>& types) {
+		if (types.empty()) {
+			return;
+		}
+		for (const auto& type : types) {
+			Shard& shard = shardFor(type);
+			auto lock = lockExclusive(shard, LockSite::Register);
+			shard.registrations_.erase(type);
+			shard.singletons_.erase(type);
+			instance_cache_.erase(type);
+		}
+		// 検証済み状態の解除と解決キャッシュの無効化
+		markRegistrationsChanged();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 全スレッドの解決キャッシュを無効化
+	//-------------------------------------------------------------
+	void Container::invalidateResolveCache() {
+		resolve_cache_epoch_.fetch_add(1, std::memory_order_release);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief スレッドローカル解決キャッシュの有効/無効を切り替え
+	//-------------------------------------------------------------
+	void Container::enableResolveCache(bool enabled) {
+		resolve_cache_enabled_.store(enabled, std::memory_order_relaxed);
+		invalidateResolveCache();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 非同期解決で使用するスレッドプールを設定
+	//-------------------------------------------------------------
+	void Container::setAsyncExecutor(ThreadPoolExecutor* executor) {
+		async_executor_ = executor;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 構築時間計測の有効/無効を切り替え
+	//-------------------------------------------------------------
+	void Container::enableConstructionTiming(bool enabled) {
+		construction_timing_enabled_.store(enabled, std::memory_order_relaxed);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 解決トレースの有効/無効を切り替え
+	//-------------------------------------------------------------
+	void Container::enableTracing(bool enabled) {
+		tracing_enabled_.store(enabled, std::memory_order_relaxed);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 依存グラフを取得
+	//-------------------------------------------------------------
+	DependencyGraph Container::exportGraph() const {
+		const auto regs = snapshotRegistrations();
+
+		// ノードを作成（未登録の依存先も破線ノードとして追加）
+		std::vector<GraphNode> nodes;
+		std::unordered_map<TypeId, std::size_t> index;
+		auto nodeOf = [&](const TypeId& type) {
+			auto it = index.find(type);
+			if (it != index.end()) return it->second;
+			GraphNode node;
+			node.type_ = type;
+			node.name_ = typeName(type);
+			node.registered_ = false;
+			nodes.push_back(std::move(node));
+			return index[type] = nodes.size() - 1;
+		};
+		for (const auto& entry : regs) {
+			const std::size_t n = nodeOf(entry.first);
+			const Registration& reg = *entry.second;
+			nodes[n].registered_ = true;
+			nodes[n].cycle_ = reg.cycle_;
+			nodes[n].constructCount_ = reg.stats_->count_.load(std::memory_order_relaxed);
+			nodes[n].totalConstructNanos_ = reg.stats_->totalNanos_.load(std::memory_order_relaxed);
+			nodes[n].maxConstructNanos_ = reg.stats_->maxNanos_.load(std::memory_order_relaxed);
+		}
+		for (const auto& entry : regs) {
+			const std::size_t n = index.at(entry.first);
+			for (const auto& dep : entry.second->deps_) {
+				const std::size_t d = nodeOf(dep);
+				// 同じ依存の重複は 1 本の辺にまとめる
+				if (std::find(nodes[n].deps_.begin(), nodes[n].deps_.end(), d) == nodes[n].deps_.end()) {
+					nodes[n].deps_.push_back(d);
+				}
+			}
+		}
+		return DependencyGraph(std::move(nodes));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録済みの依存グラフ全体を検証
+	//-------------------------------------------------------------
+	ValidationReport Container::validate() {
+		// 登録済みの型の依存を公開しているモジュールを読み込む（読み込んだ型の依存も辿る）
+		for (bool loaded = has_pending_modules_.load(std::memory_order_acquire); loaded; ) {
+			loaded = false;
+			for (const auto& entry : snapshotRegistrations()) {
+				for (const auto& dep : entry.second->deps_) {
+					if (!findRegistration(dep) && loadModuleFor(dep)) {
+						loaded = true;
+					}
+				}
+			}
+		}
+
+		// 検証対象の世代を先に読む（検証中に登録が変わった場合は検証済みにしない）
+		const std::uint64_t generation = registrationGeneration();
+		const auto regs = snapshotRegistrations();
+
+		std::unordered_map<TypeId, std::size_t> index;
+		index.reserve(regs.size());
+		for (std::size_t i = 0; i < regs.size(); ++i) {
+			index.emplace(regs[i].first, i);
+		}
+		auto chainText = [](const std::vector<TypeId>& path) {
+			std::string text;
+			for (std::size_t i = 0; i < path.size(); ++i) {
+				if (i) text += " -> ";
+				text += typeName(path[i]);
+			}
+			return text;
+		};
+
+		ValidationReport report;
+
+		// 1) 未登録の依存
+		for (const auto& entry : regs) {
+			for (const auto& dep : entry.second->deps_) {
+				if (index.find(dep) == index.end()) {
+					ValidationIssue issue{ ValidationIssueKind::MissingDependency, { entry.first, dep }, {} };
+					issue.message_ = "Type not registered: " + typeName(dep) + " (required by " + typeName(entry.first) + ")";
+					report.issues_.push_back(std::move(issue));
+				}
+			}
+		}
+
+		// 2) 循環依存（反復 DFS、処理中のノードへの辺が見つかれば循環）
+		enum class Mark { White, Gray, Black };
+		std::vector<Mark> mark(regs.size(), Mark::White);
+		std::vector<std::pair<std::size_t, std::size_t>> stack;	// (ノード, 次に調べる依存の位置)
+		for (std::size_t root = 0; root < regs.size(); ++root) {
+			if (mark[root] != Mark::White) continue;
+			stack.push_back({ root, 0 });
+			mark[root] = Mark::Gray;
+			while (!stack.empty()) {
+				auto& top = stack.back();
+				const auto& deps = regs[top.first].second->deps_;
+				if (top.second == deps.size()) {
+					mark[top.first] = Mark::Black;
+					stack.pop_back();
+					continue;
+				}
+				auto it = index.find(deps[top.second++]);
+				if (it == index.end()) continue;	// 未登録は 1) で報告済み
+				const std::size_t dep = it->second;
+				if (mark[dep] == Mark::White) {
+					mark[dep] = Mark::Gray;
+					stack.push_back({ dep, 0 });
+				}
+				else if (mark[dep] == Mark::Gray) {
+					// スタック上の dep から現在のノードまでが循環
+					std::vector<TypeId> path;
+					bool inCycle = false;
+					for (const auto& frame : stack) {
+						inCycle = inCycle || frame.first == dep;
+						if (inCycle) path.push_back(regs[frame.first].first);
+					}
+					path.push_back(regs[dep].first);
+					ValidationIssue issue{ ValidationIssueKind::CircularDependency, path, {} };
+					issue.message_ = "Circular dependency detected: " + chainText(path);
+					report.issues_.push_back(std::move(issue));
+				}
+			}
+		}
+
+		// 3) 長寿命の型が Scoped / PerThread / Cached / Replicated を保持する依存（スコープ・スレッド・ノードを越えて使われる、破棄・更新後も残る。Transient を経由する場合も含む）
+		for (std::size_t root = 0; root < regs.size(); ++root) {
+			const Lifecycle rootCycle = regs[root].second->cycle_;
+			if (!isShared(rootCycle)) continue;
+			// Transient は保持する側に取り込まれるため辿り、それ以外は個別に検査されるため辿らない
+			std::vector<std::size_t> parent(regs.size(), regs.size());
+			std::vector<bool> seen(regs.size(), false);
+			std::vector<std::size_t> queue{ root };
+			seen[root] = true;
+			for (std::size_t q = 0; q < queue.size(); ++q) {
+				const std::size_t n = queue[q];
+				for (const auto& depKey : regs[n].second->deps_) {
+					auto it = index.find(depKey);
+					if (it == index.end() || seen[it->second]) continue;
+					const std::size_t dep = it->second;
+					seen[dep] = true;
+					parent[dep] = n;
+					const Lifecycle depCycle = regs[dep].second->cycle_;
+					// Scoped は常に、PerThread は他スレッドへ持ち出される場合に捕捉される
+					// Cached は破棄されない型に保持されると破棄後も残り続ける（Cached 同士は保持する側と共に破棄される）
+					// Replicated は他の寿命の型に保持されると他ノードへ持ち出され、refreshReplicas でも更新されない
+					const bool captive = depCycle == Lifecycle::Scoped
+						|| (depCycle == Lifecycle::PerThread && rootCycle != Lifecycle::PerThread)
+						|| (depCycle == Lifecycle::Cached && rootCycle != Lifecycle::Cached)
+						|| (depCycle == Lifecycle::Replicated && rootCycle != Lifecycle::Replicated);
+					if (captive) {
+						std::vector<TypeId> path;
+						for (std::size_t p = dep; p != regs.size(); p = parent[p]) {
+							path.insert(path.begin(), regs[p].first);
+						}
+						ValidationIssue issue{ ValidationIssueKind::CaptiveDependency, path, {} };
+						issue.message_ = "Captive dependency: " + std::string(toString(rootCycle)) + " " + typeName(regs[root].first)
+							+ " holds " + toString(depCycle) + " " + typeName(regs[dep].first) + " (" + chainText(path) + ")";
+						report.issues_.push_back(std::move(issue));
+					}
+					else if (depCycle == Lifecycle::Transient) {
+						queue.push_back(dep);
+					}
+				}
+			}
+		}
+
+		// 4) Singleton 以外の依存を参照で受け取る（構築後に破棄されうる参照が残る）
+		for (const auto& entry : regs) {
+			const auto& reg = *entry.second;
+			for (std::size_t d = 0; d < reg.deps_.size(); ++d) {
+				if (!(reg.refDeps_ & (std::uint32_t{ 1 } << d))) continue;
+				auto it = index.find(reg.deps_[d]);
+				if (it == index.end()) continue;	// 未登録は 1) で報告済み
+				const Lifecycle depCycle = regs[it->second].second->cycle_;
+				if (depCycle == Lifecycle::Singleton) continue;
+				ValidationIssue issue{ ValidationIssueKind::DanglingReference, { entry.first, reg.deps_[d] }, {} };
+				issue.message_ = "Dangling reference: " + typeName(entry.first) + " takes " + toString(depCycle) + " "
+					+ typeName(reg.deps_[d]) + " by reference (only Singleton may be taken by reference)";
+				report.issues_.push_back(std::move(issue));
+			}
+		}
+
+		// 問題がなければ検証済みにする（検証中に登録が変わっていれば世代が一致しないため無効）
+		if (report.ok()) {
+			validated_generation_.store(generation, std::memory_order_release);
+		}
+		return report;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 全シャードの登録情報をスナップショット
+	//-------------------------------------------------------------
+	std::vector<std::pair<TypeId, std::shared_ptr<const Container::Registration>>> Container::snapshotRegistrations() const {
+		// シャードごとに読み取りロック
+		std::vector<std::pair<TypeId, std::shared_ptr<const Registration>>> regs;
+		for (const auto& shard : shards_) {
+			auto lock = lockShared(shard, LockSite::Snapshot);
+			for (const auto& entry : shard.registrations_) {
+				regs.emplace_back(entry.first, entry.second);
+			}
+		}
+		// fork したコンテナは子で上書きしていない親の登録を加える
+		if (parent_) {
+			std::unordered_set<TypeId> own;
+			own.reserve(regs.size());
+			for (const auto& entry : regs) {
+				own.insert(entry.first);
+			}
+			for (auto& entry : parent_->snapshotRegistrations()) {
+				if (own.find(entry.first) == own.end()) {
+					regs.push_back(std::move(entry));
+				}
+			}
+		}
+		// 出力を安定させるため名前順に並べる
+		std::sort(regs.begin(), regs.end(), [](const auto& a, const auto& b) {
+			return a.first < b.first;
+		});
+		return regs;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録内容のハッシュを計算
+	//-------------------------------------------------------------
+	std::uint64_t Container::registrationFingerprint(const std::vector<std::pair<TypeId, std::shared_ptr<const Registration>>>& regs) {
+		std::uint64_t hash = detail::kFnvOffset;
+		auto mixName = [&hash](const TypeId& type) {
+			const char* name = type.name();
+			hash = detail::fnv1a(hash, name, std::strlen(name) + 1);	// 終端も含めて区切りにする
+		};
+		for (const auto& entry : regs) {
+			mixName(entry.first);
+			const char cycle = static_cast<char>(entry.second->cycle_);
+			hash = detail::fnv1a(hash, &cycle, 1);
+			for (const auto& dep : entry.second->deps_) {
+				mixName(dep);
+			}
+			hash = detail::fnv1a(hash, "", 1);	// 依存の終わり
+		}
+		return hash;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録マニフェストを取得
+	//-------------------------------------------------------------
+	ContainerManifest Container::exportManifest() const {
+		// 検証済みかどうかは取得前後で世代が変わっていない場合のみ記録する
+		const std::uint64_t generation = registrationGeneration();
+		const bool validated = validated_generation_.load(std::memory_order_acquire) == generation;
+		const auto regs = snapshotRegistrations();
+
+		// 登録済みの型に名前順で ID を振り、未登録の依存先は末尾に追加
+		std::vector<ManifestEntry> entries;
+		std::unordered_map<TypeId, std::uint32_t> index;
+		entries.reserve(regs.size());
+		index.reserve(regs.size());
+		for (const auto& entry : regs) {
+			index.emplace(entry.first, static_cast<std::uint32_t>(entries.size()));
+			ManifestEntry item;
+			item.key_ = entry.first.name();
+			item.name_ = typeName(entry.first);
+			item.cycle_ = entry.second->cycle_;
+			entries.push_back(std::move(item));
+		}
+		for (std::size_t i = 0; i < regs.size(); ++i) {
+			for (const auto& dep : regs[i].second->deps_) {
+				auto it = index.find(dep);
+				if (it == index.end()) {
+					ManifestEntry missing;
+					missing.key_ = dep.name();
+					missing.name_ = typeName(dep);
+					missing.registered_ = false;
+					entries.push_back(std::move(missing));
+					it = index.emplace(dep, static_cast<std::uint32_t>(entries.size() - 1)).first;
+				}
+				entries[i].deps_.push_back(it->second);
+			}
+		}
+		const bool unchanged = registrationGeneration() == generation;
+		return ContainerManifest(ContainerManifest::currentBuildHash(), registrationFingerprint(regs), validated && unchanged, std::move(entries));
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録マニフェストを適用
+	//-------------------------------------------------------------
+	bool Container::loadManifest(const ContainerManifest& manifest) {
+		if (!manifest.validated() || manifest.buildHash() != ContainerManifest::currentBuildHash()) {
+			return false;
+		}
+		// 照合対象の世代を先に読む（照合中に登録が変わった場合は検証済みにしない）
+		const std::uint64_t generation = registrationGeneration();
+		const auto regs = snapshotRegistrations();
+		// ハッシュは不一致の早期判定にのみ使う（改ざんされたファイルでも一致させられるため信用しない）
+		if (registrationFingerprint(regs) != manifest.fingerprint()) {
+			return false;
+		}
+
+		// 1) 依存の計画を登録と 1 件ずつ照合（ID は名前順で、未登録の依存先は含まないこと）
+		const auto& entries = manifest.entries();
+		const std::size_t n = regs.size();
+		if (entries.size() != n) {
+			return false;
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			const auto& entry = entries[i];
+			const auto& reg = *regs[i].second;
+			if (!entry.registered_ || entry.cycle_ != reg.cycle_ || entry.key_ != regs[i].first.name() || entry.deps_.size() != reg.deps_.size()) {
+				return false;
+			}
+			for (std::size_t d = 0; d < reg.deps_.size(); ++d) {
+				if (entry.deps_[d] >= n || entries[entry.deps_[d]].key_ != reg.deps_[d].name()) {
+					return false;
+				}
+				// 参照で受け取る依存は Singleton に限る（validate の 4) と同じ規則、寿命は 1) で登録と照合済み）
+				if ((reg.refDeps_ & (std::uint32_t{ 1 } << d)) && entries[entry.deps_[d]].cycle_ != Lifecycle::Singleton) {
+					return false;
+				}
+			}
+		}
+
+		// 2) 保存されたトポロジカル順を確認（各型が依存先より後に並ぶ順序が存在すれば循環はない）
+		const auto& order = manifest.order();
+		if (order.size() != n) {
+			return false;
+		}
+		std::vector<std::size_t> position(n, n);
+		for (std::size_t p = 0; p < n; ++p) {
+			if (order[p] >= n || position[order[p]] != n) {
+				return false;
+			}
+			position[order[p]] = p;
+		}
+		for (std::size_t i = 0; i < n; ++i) {
+			for (std::uint32_t dep : entries[i].deps_) {
+				if (position[dep] >= position[i]) {
+					return false;
+				}
+			}
+		}
+
+		// 3) 長寿命の型が保持する依存の寿命をトポロジカル順に 1 回で集計（validate の 3) と同じ規則）
+		//    reach[i] は i が直接、または Transient を経由して保持する寿命の集合
+		auto bit = [](Lifecycle cycle) { return 1u << static_cast<unsigned>(cycle); };
+		std::vector<unsigned> reach(n, 0u);
+		for (std::uint32_t id : order) {
+			for (std::uint32_t dep : entries[id].deps_) {
+				reach[id] |= bit(entries[dep].cycle_);
+				if (entries[dep].cycle_ == Lifecycle::Transient) {
+					reach[id] |= reach[dep];
+				}
+			}
+			const Lifecycle rootCycle = entries[id].cycle_;
+			if (!isShared(rootCycle)) continue;
+			const bool captive = (reach[id] & bit(Lifecycle::Scoped))
+				|| (rootCycle != Lifecycle::PerThread && (reach[id] & bit(Lifecycle::PerThread)))
+				|| (rootCycle != Lifecycle::Cached && (reach[id] & bit(Lifecycle::Cached)))
+				|| (rootCycle != Lifecycle::Replicated && (reach[id] & bit(Lifecycle::Replicated)));
+			if (captive) {
+				return false;
+			}
+		}
+
+		validated_generation_.store(generation, std::memory_order_release);
+		return registrationGeneration() == generation;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief シャードのロックの計測結果を取得
+	//-------------------------------------------------------------
+	LockProfile Container::lockProfile() const {
+		LockProfile profile;
+#if TSUKINO_DI_LOCK_PROFILING
+		profile.enabled_ = true;
+		profile.sites_.reserve(kLockSiteCount);
+		for (std::size_t i = 0; i < kLockSiteCount; ++i) {
+			profile.sites_.push_back(lock_counters_[i].snapshot(static_cast<LockSite>(i)));
+		}
+#endif
+		return profile;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief シャードのロックの計測結果を 0 に戻す
+	//-------------------------------------------------------------
+	void Container::resetLockProfile() {
+#if TSUKINO_DI_LOCK_PROFILING
+		for (auto& counters : lock_counters_) {
+			counters.reset();
+		}
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 型ごとのインスタンス計上値を取得
+	//-------------------------------------------------------------
+	InstanceAccounting Container::instanceAccounting() const {
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+		std::vector<TypeAccounting> types;
+		for (const auto& shard : shards_) {
+			auto lock = lockShared(shard, LockSite::Snapshot);
+			for (const auto& [type, reg] : shard.registrations_) {
+				auto stats = reg->accounting_->snapshot(type);
+				if (stats.constructed_ > 0) {
+					types.push_back(stats);
+				}
+			}
+		}
+		return detail::makeInstanceAccounting(std::move(types));
+#else
+		return InstanceAccounting{};
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Cached 型の保持方針を設定
+	//-------------------------------------------------------------
+	void Container::setCachePolicy(const CachePolicy& policy) {
+		instance_cache_.setPolicy(policy);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Cached 型の保持状況を取得
+	//-------------------------------------------------------------
+	CacheStats Container::cacheStats() const {
+		return instance_cache_.stats();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief Cached 型の保持中のインスタンスを全て破棄
+	//-------------------------------------------------------------
+	void Container::clearCache() {
+		instance_cache_.clear();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief 登録表を共有する子コンテナを生成
+	//-------------------------------------------------------------
+	std::unique_ptr<Container> Container::fork() {
+		// 子は親を所有する（親を先に手放しても子から参照できる）
+		auto self = weak_from_this().lock();
+		if (!self) {
+			throw ResolveException("fork() requires the container to be owned by std::shared_ptr");
+		}
+		auto child = std::make_unique<Container>();
+		child->parent_ = std::move(self);	// 登録表は複製せず、未登録の型を親へ問い合わせる
+		live_forks_.fetch_add(1, std::memory_order_acq_rel);
+		return child;
+	}
 
 	//-------------------------------------------------------------
-	//! @brief ScopedContext𐶐
+	//! @brief ScopedContextを生成
 	//-------------------------------------------------------------
 	ScopedContext Container::createScope() {
-		return ScopedContext(*this);	// ScopedContext Ԃ
+		return ScopedContext(*this);	// ScopedContext を返す
 	}
 } // namespace TsukinoDIContainer
\ No newline at end of file
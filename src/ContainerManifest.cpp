@@ -0,0 +1,329 @@
+//-------------------------------------------------------------
+//! @file   ContainerManifest.cpp
+//! @brief  依存性注入コンテナライブラリの登録マニフェスト実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/ContainerManifest.hpp"
+#include "TsukinoDIContainer/ResolveException.hpp"
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		constexpr char kMagic[4] = { 'T', 'D', 'I', 'M' };	// バイナリ形式の識別子
+		constexpr std::uint32_t kVersion = 1;				// バイナリ形式の版
+		constexpr std::size_t kHeaderSize = 16;				// 識別子 + 版 + ビルドのハッシュ
+		constexpr std::uint32_t kFlagValidated = 1u << 0;	// 作成時に検証済み
+		constexpr std::uint32_t kFlagAcyclic = 1u << 1;		// 循環なし
+
+		//---------------------------------------------------------
+		//! @brief  文字列を JSON の二重引用符内向けにエスケープ
+		//---------------------------------------------------------
+		std::string escape(const std::string& text) {
+			std::string out;
+			out.reserve(text.size());
+			for (char c : text) {
+				if (c == '"' || c == '\\') {
+					out += '\\';
+					out += c;
+				}
+				else if (static_cast<unsigned char>(c) < 0x20) {
+					out += ' ';	// 制御文字は空白に置換
+				}
+				else {
+					out += c;
+				}
+			}
+			return out;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  整数をリトルエンディアンで追加
+		//---------------------------------------------------------
+		template<typename T>
+		void put(std::string& out, T value) {
+			for (std::size_t i = 0; i < sizeof(T); ++i) {
+				out += static_cast<char>((value >> (8 * i)) & 0xff);
+			}
+		}
+
+		//---------------------------------------------------------
+		//! @brief  長さ付き文字列を追加
+		//---------------------------------------------------------
+		void putString(std::string& out, const std::string& text) {
+			put<std::uint32_t>(out, static_cast<std::uint32_t>(text.size()));
+			out += text;
+		}
+
+		//---------------------------------------------------------
+		//! @struct  Reader
+		//! @brief   範囲確認付きのバイナリ読み取り
+		//---------------------------------------------------------
+		struct Reader {
+			const std::string& data_;	// 読み取り対象
+			std::size_t pos_ = 0;		// 読み取り位置
+
+			//! @brief 残りが足りなければ例外
+			void require(std::size_t size) const {
+				if (data_.size() - pos_ < size) {
+					throw ResolveException("Invalid manifest: truncated data");
+				}
+			}
+			//! @brief 整数をリトルエンディアンで読み取る
+			template<typename T>
+			T get() {
+				require(sizeof(T));
+				T value = 0;
+				for (std::size_t i = 0; i < sizeof(T); ++i) {
+					value |= static_cast<T>(static_cast<unsigned char>(data_[pos_ + i])) << (8 * i);
+				}
+				pos_ += sizeof(T);
+				return value;
+			}
+			//! @brief 長さ付き文字列を読み取る
+			std::string getString() {
+				const std::uint32_t size = get<std::uint32_t>();
+				require(size);
+				std::string text = data_.substr(pos_, size);
+				pos_ += size;
+				return text;
+			}
+		};
+
+		//---------------------------------------------------------
+		//! @brief  ビルド識別文字列
+		//---------------------------------------------------------
+#if defined(TSUKINO_DI_BUILD_ID)
+		constexpr const char* kBuildId = TSUKINO_DI_BUILD_ID;
+#else
+		constexpr const char* kBuildId = __DATE__ " " __TIME__;
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	ContainerManifest::ContainerManifest(std::uint64_t buildHash, std::uint64_t fingerprint, bool validated, std::vector<ManifestEntry> entries)
+		: buildHash_(buildHash), fingerprint_(fingerprint), validated_(validated), entries_(std::move(entries)) {
+		// 依存される側が先に並ぶトポロジカル順（Kahn 法、同順位は ID 順）
+		const std::size_t n = entries_.size();
+		std::vector<std::size_t> pending(n, 0);
+		std::vector<std::vector<std::uint32_t>> dependents(n);
+		for (std::size_t i = 0; i < n; ++i) {
+			pending[i] = entries_[i].deps_.size();
+			for (std::uint32_t dep : entries_[i].deps_) {
+				dependents[dep].push_back(static_cast<std::uint32_t>(i));
+			}
+		}
+		std::deque<std::uint32_t> ready;
+		for (std::size_t i = 0; i < n; ++i) {
+			if (pending[i] == 0) {
+				ready.push_back(static_cast<std::uint32_t>(i));
+			}
+		}
+		order_.reserve(n);
+		std::vector<bool> placed(n, false);
+		while (!ready.empty()) {
+			const std::uint32_t id = ready.front();
+			ready.pop_front();
+			order_.push_back(id);
+			placed[id] = true;
+			for (std::uint32_t dependent : dependents[id]) {
+				if (--pending[dependent] == 0) {
+					ready.push_back(dependent);
+				}
+			}
+		}
+		// 循環に含まれる（または循環に依存する）型は末尾に ID 順で並べる
+		acyclic_ = order_.size() == n;
+		for (std::size_t i = 0; i < n; ++i) {
+			if (!placed[i]) {
+				order_.push_back(static_cast<std::uint32_t>(i));
+			}
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  現在のビルドのハッシュを取得
+	//-------------------------------------------------------------
+	std::uint64_t ContainerManifest::currentBuildHash() {
+		static const std::uint64_t hash = detail::fnv1a(detail::kFnvOffset, kBuildId, std::strlen(kBuildId));
+		return hash;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  バイナリ形式から読み込み
+	//-------------------------------------------------------------
+	ContainerManifest ContainerManifest::fromBinary(const std::string& data, std::uint64_t expectedBuildHash) {
+		// 固定長ヘッダだけで古いファイルを拒否する
+		if (data.size() < kHeaderSize || std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0) {
+			throw ResolveException("Invalid manifest: bad header");
+		}
+		Reader reader{ data, sizeof(kMagic) };
+		if (reader.get<std::uint32_t>() != kVersion) {
+			throw ResolveException("Invalid manifest: unsupported version");
+		}
+		ContainerManifest manifest;
+		manifest.buildHash_ = reader.get<std::uint64_t>();
+		if (manifest.buildHash_ != expectedBuildHash) {
+			throw ResolveException("Stale manifest: build hash mismatch");
+		}
+
+		// 本体（保存されたトポロジカル順はそのまま使う）
+		manifest.fingerprint_ = reader.get<std::uint64_t>();
+		const std::uint32_t flags = reader.get<std::uint32_t>();
+		manifest.validated_ = (flags & kFlagValidated) != 0;
+		manifest.acyclic_ = (flags & kFlagAcyclic) != 0;
+		const std::uint32_t count = reader.get<std::uint32_t>();
+		reader.require(count);	// 1 件あたり 1 バイト以上
+		manifest.entries_.resize(count);
+		for (auto& entry : manifest.entries_) {
+			entry.key_ = reader.getString();
+			entry.name_ = reader.getString();
+			const std::uint8_t cycle = reader.get<std::uint8_t>();
+			if (cycle > static_cast<std::uint8_t>(Lifecycle::Replicated)) {
+				throw ResolveException("Invalid manifest: unknown lifecycle");
+			}
+			entry.cycle_ = static_cast<Lifecycle>(cycle);
+			entry.registered_ = reader.get<std::uint8_t>() != 0;
+			const std::uint32_t deps = reader.get<std::uint32_t>();
+			reader.require(static_cast<std::size_t>(deps) * sizeof(std::uint32_t));
+			entry.deps_.resize(deps);
+			for (auto& dep : entry.deps_) {
+				dep = reader.get<std::uint32_t>();
+				if (dep >= count) {
+					throw ResolveException("Invalid manifest: dependency id out of range");
+				}
+			}
+		}
+		const std::uint32_t orderCount = reader.get<std::uint32_t>();
+		if (orderCount != count) {
+			throw ResolveException("Invalid manifest: order size mismatch");
+		}
+		manifest.order_.resize(orderCount);
+		for (auto& id : manifest.order_) {
+			id = reader.get<std::uint32_t>();
+			if (id >= count) {
+				throw ResolveException("Invalid manifest: order id out of range");
+			}
+		}
+		return manifest;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  バイナリ形式で出力
+	//-------------------------------------------------------------
+	std::string ContainerManifest::toBinary() const {
+		std::string out;
+		out.append(kMagic, sizeof(kMagic));
+		put<std::uint32_t>(out, kVersion);
+		put<std::uint64_t>(out, buildHash_);
+		put<std::uint64_t>(out, fingerprint_);
+		put<std::uint32_t>(out, (validated_ ? kFlagValidated : 0u) | (acyclic_ ? kFlagAcyclic : 0u));
+		put<std::uint32_t>(out, static_cast<std::uint32_t>(entries_.size()));
+		for (const auto& entry : entries_) {
+			putString(out, entry.key_);
+			putString(out, entry.name_);
+			put<std::uint8_t>(out, static_cast<std::uint8_t>(entry.cycle_));
+			put<std::uint8_t>(out, entry.registered_ ? 1 : 0);
+			put<std::uint32_t>(out, static_cast<std::uint32_t>(entry.deps_.size()));
+			for (std::uint32_t dep : entry.deps_) {
+				put<std::uint32_t>(out, dep);
+			}
+		}
+		put<std::uint32_t>(out, static_cast<std::uint32_t>(order_.size()));
+		for (std::uint32_t id : order_) {
+			put<std::uint32_t>(out, id);
+		}
+		return out;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  JSON 形式で出力
+	//-------------------------------------------------------------
+	std::string ContainerManifest::toJson() const {
+		std::ostringstream os;
+		os << std::hex << std::setfill('0');
+		os << "{\n  \"buildHash\": \"" << std::setw(16) << buildHash_ << "\""
+			<< ",\n  \"fingerprint\": \"" << std::setw(16) << fingerprint_ << "\"";
+		os << std::dec;
+		os << ",\n  \"validated\": " << (validated_ ? "true" : "false")
+			<< ",\n  \"acyclic\": " << (acyclic_ ? "true" : "false")
+			<< ",\n  \"types\": [";
+		for (std::size_t i = 0; i < entries_.size(); ++i) {
+			const auto& entry = entries_[i];
+			os << (i ? ",\n" : "\n");
+			os << "    {\"id\": " << i
+				<< ", \"name\": \"" << escape(entry.name_) << "\""
+				<< ", \"key\": \"" << escape(entry.key_) << "\""
+				<< ", \"registered\": " << (entry.registered_ ? "true" : "false")
+				<< ", \"lifecycle\": \"" << toString(entry.cycle_) << "\""
+				<< ", \"deps\": [";
+			for (std::size_t d = 0; d < entry.deps_.size(); ++d) {
+				os << (d ? ", " : "") << entry.deps_[d];
+			}
+			os << "]}";
+		}
+		os << "\n  ],\n  \"order\": [";
+		for (std::size_t i = 0; i < order_.size(); ++i) {
+			os << (i ? ", " : "") << order_[i];
+		}
+		os << "]\n}\n";
+		return os.str();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  別のマニフェストとの差分を取得
+	//-------------------------------------------------------------
+	std::vector<std::string> ContainerManifest::diff(const ContainerManifest& newer) const {
+		// 依存を表示名の一覧に変換
+		auto depsText = [](const ContainerManifest& manifest, const ManifestEntry& entry) {
+			std::string text = "[";
+			for (std::size_t i = 0; i < entry.deps_.size(); ++i) {
+				if (i) text += ", ";
+				text += manifest.entries_[entry.deps_[i]].name_;
+			}
+			return text + "]";
+		};
+		auto stateText = [](const ManifestEntry& entry) {
+			return std::string(entry.registered_ ? toString(entry.cycle_) : "(not registered)");
+		};
+
+		std::unordered_map<std::string, const ManifestEntry*> after;
+		after.reserve(newer.entries_.size());
+		for (const auto& entry : newer.entries_) {
+			after.emplace(entry.name_, &entry);
+		}
+
+		std::vector<std::string> changes;
+		std::unordered_set<std::string> seen;
+		for (const auto& entry : entries_) {
+			seen.insert(entry.name_);
+			auto it = after.find(entry.name_);
+			if (it == after.end()) {
+				changes.push_back("- " + entry.name_);
+				continue;
+			}
+			const ManifestEntry& other = *it->second;
+			if (entry.registered_ != other.registered_ || entry.cycle_ != other.cycle_) {
+				changes.push_back("~ " + entry.name_ + ": " + stateText(entry) + " -> " + stateText(other));
+			}
+			const std::string before = depsText(*this, entry);
+			const std::string now = depsText(newer, other);
+			if (before != now) {
+				changes.push_back("~ " + entry.name_ + ": deps " + before + " -> " + now);
+			}
+		}
+		for (const auto& entry : newer.entries_) {
+			if (seen.find(entry.name_) == seen.end()) {
+				changes.push_back("+ " + entry.name_);
+			}
+		}
+		return changes;
+	}
+}// namespace TsukinoDIContainer
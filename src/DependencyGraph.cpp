@@ -0,0 +1,219 @@
+//-------------------------------------------------------------
+//! @file   DependencyGraph.cpp
+//! @brief  依存性注入コンテナライブラリの依存グラフ実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/DependencyGraph.hpp"
+#include <algorithm>
+#include <sstream>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @brief  文字列を JSON / DOT の二重引用符内向けにエスケープ
+		//---------------------------------------------------------
+		std::string escape(const std::string& text) {
+			std::string out;
+			out.reserve(text.size());
+			for (char c : text) {
+				switch (c) {
+				case '"':  out += "\\\""; break;
+				case '\\': out += "\\\\"; break;
+				case '\n': out += "\\n"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20) {
+						out += ' ';	// その他の制御文字は空白に置換
+					}
+					else {
+						out += c;
+					}
+				}
+			}
+			return out;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  ナノ秒を読みやすい単位の文字列に変換
+		//---------------------------------------------------------
+		std::string formatNanos(std::uint64_t ns) {
+			std::ostringstream os;
+			os.setf(std::ios::fixed);
+			os.precision(1);
+			if (ns >= 1000000) {
+				os << (static_cast<double>(ns) / 1000000.0) << "ms";
+			}
+			else if (ns >= 1000) {
+				os << (static_cast<double>(ns) / 1000.0) << "us";
+			}
+			else {
+				os << ns << "ns";
+			}
+			return os.str();
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	DependencyGraph::DependencyGraph(std::vector<GraphNode> nodes)
+		: nodes_(std::move(nodes)) {
+		analyze();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  次数・レベル・クリティカルパス・並列幅を計算
+	//-------------------------------------------------------------
+	void DependencyGraph::analyze() {
+		const std::size_t count = nodes_.size();
+
+		// 入次数・出次数
+		for (auto& node : nodes_) {
+			node.fanOut_ = node.deps_.size();
+			for (auto dep : node.deps_) {
+				++nodes_[dep].fanIn_;
+			}
+		}
+
+		// 反復 DFS の帰りがけ順で処理し、依存先を先に確定させる
+		// 処理中（GRAY）のノードへの辺は循環を構成するため無視する
+		enum class Mark { White, Gray, Black };
+		std::vector<Mark> mark(count, Mark::White);
+		std::vector<std::uint64_t> cost(count, 0);						// そのノードから始まる最長経路の重み
+		std::vector<std::size_t> next(count, count);					// 最長経路上の次のノード
+		std::vector<std::pair<std::size_t, std::size_t>> stack;			// (ノード, 次に調べる依存の位置)
+
+		for (std::size_t root = 0; root < count; ++root) {
+			if (mark[root] != Mark::White) continue;
+			stack.push_back({ root, 0 });
+			mark[root] = Mark::Gray;
+			while (!stack.empty()) {
+				auto& top = stack.back();
+				const std::size_t n = top.first;
+				if (top.second < nodes_[n].deps_.size()) {
+					const std::size_t dep = nodes_[n].deps_[top.second++];
+					if (mark[dep] == Mark::White) {
+						mark[dep] = Mark::Gray;
+						stack.push_back({ dep, 0 });
+					}
+					continue;
+				}
+				// 全依存を処理済み：レベルと最長経路を確定
+				for (auto dep : nodes_[n].deps_) {
+					if (mark[dep] != Mark::Black) continue;	// 循環辺は無視
+					nodes_[n].level_ = std::max(nodes_[n].level_, nodes_[dep].level_ + 1);
+					if (next[n] == count || cost[dep] > cost[next[n]]) {
+						next[n] = dep;
+					}
+				}
+				cost[n] = nodes_[n].averageConstructNanos() + (next[n] != count ? cost[next[n]] : 0);
+				mark[n] = Mark::Black;
+				stack.pop_back();
+			}
+		}
+
+		// クリティカルパス：重みが最大のノードから最長経路を辿る
+		criticalPath_.clear();
+		criticalPathNanos_ = 0;
+		if (count > 0) {
+			std::size_t start = 0;
+			for (std::size_t i = 1; i < count; ++i) {
+				if (cost[i] > cost[start] || (cost[i] == cost[start] && nodes_[i].level_ > nodes_[start].level_)) {
+					start = i;
+				}
+			}
+			criticalPathNanos_ = cost[start];
+			for (std::size_t n = start; n != count; n = next[n]) {
+				criticalPath_.push_back(n);
+			}
+		}
+
+		// 並列幅：同一レベルに並ぶノード数の最大値
+		std::vector<std::size_t> perLevel;
+		for (const auto& node : nodes_) {
+			if (perLevel.size() <= node.level_) {
+				perLevel.resize(node.level_ + 1, 0);
+			}
+			++perLevel[node.level_];
+		}
+		parallelWidth_ = perLevel.empty() ? 0 : *std::max_element(perLevel.begin(), perLevel.end());
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  Graphviz DOT 形式で出力
+	//-------------------------------------------------------------
+	std::string DependencyGraph::toDot() const {
+		// クリティカルパス上の辺を判定するため、次のノードを記録
+		std::vector<std::size_t> onPath(nodes_.size(), nodes_.size());
+		for (std::size_t i = 0; i + 1 < criticalPath_.size(); ++i) {
+			onPath[criticalPath_[i]] = criticalPath_[i + 1];
+		}
+
+		std::ostringstream os;
+		os << "digraph TsukinoDIContainer {\n";
+		os << "  node [shape=box];\n";
+		for (std::size_t i = 0; i < nodes_.size(); ++i) {
+			const auto& node = nodes_[i];
+			os << "  n" << i << " [label=\"" << escape(node.name_);
+			if (node.registered_) {
+				os << "\\n" << toString(node.cycle_);
+				if (node.constructCount_) {
+					os << "\\n" << formatNanos(node.averageConstructNanos()) << " x" << node.constructCount_;
+				}
+				os << "\"";
+			}
+			else {
+				os << "\\n(not registered)\", style=dashed";
+			}
+			if (std::find(criticalPath_.begin(), criticalPath_.end(), i) != criticalPath_.end()) {
+				os << ", color=red";
+			}
+			os << "];\n";
+		}
+		for (std::size_t i = 0; i < nodes_.size(); ++i) {
+			for (auto dep : nodes_[i].deps_) {
+				os << "  n" << i << " -> n" << dep;
+				if (onPath[i] == dep) {
+					os << " [color=red]";
+				}
+				os << ";\n";
+			}
+		}
+		os << "}\n";
+		return os.str();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  JSON 形式で出力
+	//-------------------------------------------------------------
+	std::string DependencyGraph::toJson() const {
+		std::ostringstream os;
+		os << "{\n  \"nodes\": [";
+		for (std::size_t i = 0; i < nodes_.size(); ++i) {
+			const auto& node = nodes_[i];
+			os << (i ? ",\n" : "\n");
+			os << "    {\"id\": " << i
+				<< ", \"name\": \"" << escape(node.name_) << "\""
+				<< ", \"registered\": " << (node.registered_ ? "true" : "false")
+				<< ", \"lifecycle\": \"" << toString(node.cycle_) << "\""
+				<< ", \"deps\": [";
+			for (std::size_t d = 0; d < node.deps_.size(); ++d) {
+				os << (d ? ", " : "") << node.deps_[d];
+			}
+			os << "], \"fanIn\": " << node.fanIn_
+				<< ", \"fanOut\": " << node.fanOut_
+				<< ", \"level\": " << node.level_
+				<< ", \"constructCount\": " << node.constructCount_
+				<< ", \"avgConstructNs\": " << node.averageConstructNanos()
+				<< ", \"maxConstructNs\": " << node.maxConstructNanos_
+				<< ", \"totalConstructNs\": " << node.totalConstructNanos_ << "}";
+		}
+		os << "\n  ],\n  \"criticalPath\": [";
+		for (std::size_t i = 0; i < criticalPath_.size(); ++i) {
+			os << (i ? ", " : "") << criticalPath_[i];
+		}
+		os << "],\n  \"criticalPathNs\": " << criticalPathNanos_
+			<< ",\n  \"parallelWidth\": " << parallelWidth_ << "\n}\n";
+		return os.str();
+	}
+}// namespace TsukinoDIContainer
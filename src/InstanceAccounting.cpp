@@ -0,0 +1,141 @@
+//-------------------------------------------------------------
+//! @file   InstanceAccounting.cpp
+//! @brief  依存性注入コンテナライブラリのインスタンス計上実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/InstanceAccounting.hpp"
+#include "TsukinoDIContainer/ResolveException.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @brief 最大値を更新
+		//---------------------------------------------------------
+		template<typename T>
+		void updateMax(std::atomic<T>& target, T value) {
+			T prev = target.load(std::memory_order_relaxed);
+			while (prev < value && !target.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {}
+		}
+
+		//---------------------------------------------------------
+		//! @brief スコープの型ごとの計上値を取得（なければ追加）
+		//---------------------------------------------------------
+		std::shared_ptr<detail::AccountingCounters> scopeCounters(const TypeId& type, Lifecycle cycle) {
+			detail::ScopeAccounting* scope = detail::currentScopeAccounting();
+			if (!scope || isShared(cycle)) {
+				return nullptr;
+			}
+			auto& counters = scope->types_[type];
+			if (!counters) {
+				counters = std::make_shared<detail::AccountingCounters>();
+			}
+			return counters;
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  型ごとに 1 行ずつ並べた文字列を取得
+	//-------------------------------------------------------------
+	std::string InstanceAccounting::toString() const {
+		if (!enabled_) {
+			return "Instance accounting is disabled (define TSUKINO_DI_INSTANCE_ACCOUNTING=1)\n";
+		}
+		std::string text = "type                            constructed      live  peakLive  liveBytes  peakBytes\n";
+		char line[192];
+		for (const auto& type : types_) {
+			std::snprintf(line, sizeof(line), "%-30.30s %12llu %9llu %9llu %10llu %10llu\n",
+				typeName(type.type_).c_str(),
+				static_cast<unsigned long long>(type.constructed_),
+				static_cast<unsigned long long>(type.live_),
+				static_cast<unsigned long long>(type.peakLive_),
+				static_cast<unsigned long long>(type.liveBytes_),
+				static_cast<unsigned long long>(type.peakBytes_));
+			text += line;
+		}
+		return text;
+	}
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  構築を記録
+		//---------------------------------------------------------
+		void AccountingCounters::onConstruct(std::size_t bytes) {
+			constructed_.fetch_add(1, std::memory_order_relaxed);
+			updateMax(peakLive_, live_.fetch_add(1, std::memory_order_relaxed) + 1);
+			updateMax(peakBytes_, liveBytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+		}
+
+		//---------------------------------------------------------
+		//! @brief  破棄を記録
+		//---------------------------------------------------------
+		void AccountingCounters::onDestroy(std::size_t bytes) noexcept {
+			live_.fetch_sub(1, std::memory_order_relaxed);
+			liveBytes_.fetch_sub(bytes, std::memory_order_relaxed);
+		}
+
+		//---------------------------------------------------------
+		//! @brief  計上値を取得
+		//---------------------------------------------------------
+		TypeAccounting AccountingCounters::snapshot(const TypeId& type) const {
+			TypeAccounting stats;
+			stats.type_ = type;
+			stats.constructed_ = constructed_.load(std::memory_order_relaxed);
+			stats.live_ = live_.load(std::memory_order_relaxed);
+			stats.peakLive_ = peakLive_.load(std::memory_order_relaxed);
+			stats.liveBytes_ = liveBytes_.load(std::memory_order_relaxed);
+			stats.peakBytes_ = peakBytes_.load(std::memory_order_relaxed);
+			return stats;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  呼び出しスレッドで解決中のスコープの計上先を取得
+		//---------------------------------------------------------
+		ScopeAccounting*& currentScopeAccounting() noexcept {
+			thread_local ScopeAccounting* current = nullptr;
+			return current;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  構築したインスタンスを計上し、破棄時に減算するよう包む
+		//---------------------------------------------------------
+		std::shared_ptr<void> trackInstance(const TypeId& type, Lifecycle cycle, std::shared_ptr<void> instance,
+			std::size_t bytes, const std::shared_ptr<AccountingCounters>& counters) {
+			if (!instance || !counters) {
+				return instance;
+			}
+			auto scope = scopeCounters(type, cycle);
+			counters->onConstruct(bytes);
+			if (scope) {
+				scope->onConstruct(bytes);
+			}
+			// 元の参照を削除子に持たせ、最後の参照が外れた時点で減算する（アドレスは変わらない）
+			void* raw = instance.get();
+			return std::shared_ptr<void>(raw, [inner = std::move(instance), counters, scope, bytes](void*) mutable {
+				inner.reset();
+				counters->onDestroy(bytes);
+				if (scope) {
+					scope->onDestroy(bytes);
+				}
+			});
+		}
+
+		//---------------------------------------------------------
+		//! @brief  計上値の一覧を並べ替えて結果を生成
+		//---------------------------------------------------------
+		InstanceAccounting makeInstanceAccounting(std::vector<TypeAccounting> types) {
+			InstanceAccounting accounting;
+			accounting.enabled_ = true;
+			// 残っているサイズ、次に数の多い順（リークの疑いが大きいものを先頭に）
+			std::sort(types.begin(), types.end(), [](const TypeAccounting& a, const TypeAccounting& b) {
+				if (a.liveBytes_ != b.liveBytes_) return a.liveBytes_ > b.liveBytes_;
+				if (a.live_ != b.live_) return a.live_ > b.live_;
+				return a.constructed_ > b.constructed_;
+			});
+			accounting.types_ = std::move(types);
+			return accounting;
+		}
+	}
+}// namespace TsukinoDIContainer
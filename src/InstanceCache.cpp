@@ -0,0 +1,136 @@
+//-------------------------------------------------------------
+//! @file   InstanceCache.cpp
+//! @brief  依存性注入コンテナライブラリの Cached ライフサイクル用キャッシュ実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/InstanceCache.hpp"
+#include <iterator>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @brief  保持中のインスタンスを取得
+	//-------------------------------------------------------------
+	std::shared_ptr<void> InstanceCache::get(const TypeId& key, const void* owner) {
+		EntryList removed;	// ロック外で破棄する（デストラクタからの再入に備える）
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto found = index_.find(key);
+		if (found == index_.end()) {
+			++stats_.misses_;
+			return nullptr;
+		}
+		auto it = found->second;
+		if (it->owner_ != owner) {
+			// replace 前の登録で構築したインスタンス
+			unlink(it, removed);
+			++stats_.misses_;
+			return nullptr;
+		}
+		if (it->expires_ <= std::chrono::steady_clock::now()) {
+			unlink(it, removed);
+			++stats_.expirations_;
+			++stats_.misses_;
+			return nullptr;
+		}
+		// 最近参照したものとして先頭へ移す
+		lru_.splice(lru_.begin(), lru_, it);
+		++stats_.hits_;
+		return it->instance_;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  構築したインスタンスを保持
+	//-------------------------------------------------------------
+	std::shared_ptr<void> InstanceCache::put(const TypeId& key, const void* owner, std::shared_ptr<void> instance, std::size_t bytes) {
+		EntryList removed;
+		std::lock_guard<std::mutex> lock(mutex_);
+		const auto now = std::chrono::steady_clock::now();
+		auto found = index_.find(key);
+		if (found != index_.end()) {
+			auto it = found->second;
+			if (it->owner_ == owner && it->expires_ > now) {
+				// 構築中に他スレッドが保持した
+				lru_.splice(lru_.begin(), lru_, it);
+				return it->instance_;
+			}
+			unlink(it, removed);
+		}
+		const auto expires = policy_.ttl_.count() > 0 ? now + policy_.ttl_ : std::chrono::steady_clock::time_point::max();
+		lru_.push_front(Entry{ key, owner, instance, bytes, expires });
+		index_.emplace(key, lru_.begin());
+		stats_.bytes_ += bytes;
+		trim(now, removed);
+		return instance;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  型のインスタンスを破棄
+	//-------------------------------------------------------------
+	void InstanceCache::erase(const TypeId& key) {
+		EntryList removed;
+		std::lock_guard<std::mutex> lock(mutex_);
+		auto found = index_.find(key);
+		if (found != index_.end()) {
+			unlink(found->second, removed);
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  全てのインスタンスを破棄
+	//-------------------------------------------------------------
+	void InstanceCache::clear() {
+		EntryList removed;
+		std::lock_guard<std::mutex> lock(mutex_);
+		removed.splice(removed.end(), lru_);
+		index_.clear();
+		stats_.bytes_ = 0;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  保持方針を設定
+	//-------------------------------------------------------------
+	void InstanceCache::setPolicy(const CachePolicy& policy) {
+		EntryList removed;
+		std::lock_guard<std::mutex> lock(mutex_);
+		policy_ = policy;
+		trim(std::chrono::steady_clock::now(), removed);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  集計値を取得
+	//-------------------------------------------------------------
+	CacheStats InstanceCache::stats() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		CacheStats stats = stats_;
+		stats.entries_ = index_.size();
+		return stats;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  期限切れと上限超過の分を取り出す
+	//-------------------------------------------------------------
+	void InstanceCache::trim(std::chrono::steady_clock::time_point now, EntryList& removed) {
+		// 保持するのは型ごとに 1 つのため、全件走査で期限切れを取り出す
+		for (auto it = lru_.begin(); it != lru_.end();) {
+			auto next = std::next(it);
+			if (it->expires_ <= now) {
+				unlink(it, removed);
+				++stats_.expirations_;
+			}
+			it = next;
+		}
+		// 上限を超えていれば最も長く参照されていないものから取り出す
+		while (policy_.byteBudget_ > 0 && stats_.bytes_ > policy_.byteBudget_ && !lru_.empty()) {
+			unlink(std::prev(lru_.end()), removed);
+			++stats_.evictions_;
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  エントリを取り出す
+	//-------------------------------------------------------------
+	void InstanceCache::unlink(EntryList::iterator it, EntryList& removed) {
+		stats_.bytes_ -= it->bytes_;
+		index_.erase(it->key_);
+		removed.splice(removed.end(), lru_, it);
+	}
+}// namespace TsukinoDIContainer
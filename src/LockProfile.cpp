@@ -0,0 +1,33 @@
+//-------------------------------------------------------------
+//! @file   LockProfile.cpp
+//! @brief  依存性注入コンテナライブラリのロック計測実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/LockProfile.hpp"
+#include <cstdio>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @brief  呼び出し箇所ごとに 1 行ずつ並べた文字列を取得
+	//-------------------------------------------------------------
+	std::string LockProfile::toString() const {
+		if (!enabled_) {
+			return "Lock profiling is disabled (define TSUKINO_DI_LOCK_PROFILING=1)\n";
+		}
+		std::string text = "site            acquire  contended  wait(us)  maxWait(us)  hold(us)  maxHold(us)  maxWaiters\n";
+		char line[160];
+		for (const auto& site : sites_) {
+			std::snprintf(line, sizeof(line), "%-14s %8llu %10llu %9.1f %12.1f %9.1f %12.1f %11llu\n",
+				TsukinoDIContainer::toString(site.site_),
+				static_cast<unsigned long long>(site.acquisitions_),
+				static_cast<unsigned long long>(site.contended_),
+				site.waitNanos_ / 1000.0,
+				site.maxWaitNanos_ / 1000.0,
+				site.holdNanos_ / 1000.0,
+				site.maxHoldNanos_ / 1000.0,
+				static_cast<unsigned long long>(site.maxWaiters_));
+			text += line;
+		}
+		return text;
+	}
+}// namespace TsukinoDIContainer
@@ -0,0 +1,331 @@
+//-------------------------------------------------------------
+//! @file   ObjectPool.cpp
+//! @brief  依存性注入コンテナライブラリの Pooled ライフサイクル用オブジェクトプール実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/ObjectPool.hpp"
+#include <array>
+#include <algorithm>
+#include <new>
+#include <cstdint>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @struct  LocalList
+		//! @brief   プール 1 つ分のスレッドローカル空きリスト
+		//! @details プールは弱参照で保持し、生存を延ばさない。対象の確認は通し番号で行う。
+		//!          プールが破棄済みならスロットもプールが破棄済みのため、触れずに捨てる。
+		//---------------------------------------------------------
+		struct LocalList {
+			std::weak_ptr<ObjectPool> pool_;											// 対象プール
+			std::uint64_t serial_ = 0;													// 対象プールの通し番号（0 は未使用）
+			std::array<ObjectPool::Slot*, ObjectPool::kLocalCapacity> items_{};		// 空きスロット
+			std::size_t count_ = 0;														// 空きスロット数
+
+			//! @brief 全ての空きスロットを共有リストへ戻す
+			void flush() {
+				// 破棄されるオブジェクトからの再入に備え、先に空にしてから戻す
+				const auto items = items_;
+				const std::size_t count = count_;
+				count_ = 0;
+				if (count) {
+					if (auto pool = pool_.lock()) {
+						pool->returnShared(items.data(), count);
+					}
+				}
+			}
+
+			//! @brief 対象プールを切り替える（旧プールの空きスロットは切り替え後に戻す）
+			void rebind(ObjectPool& pool) {
+				const auto items = items_;
+				const std::size_t count = count_;
+				count_ = 0;
+				std::weak_ptr<ObjectPool> previous = std::exchange(pool_, pool.weak_from_this());
+				serial_ = pool.serial();
+				if (count) {
+					if (auto owner = previous.lock()) {
+						owner->returnShared(items.data(), count);
+					}
+				}
+			}
+		};
+
+		constexpr std::size_t kLocalLists = 16;	// スレッドあたりのローカルリスト数（2 の冪）
+
+		//---------------------------------------------------------
+		//! @struct  LocalLists
+		//! @brief   スレッドローカル空きリストの集合（スレッド終了時に共有リストへ戻す）
+		//---------------------------------------------------------
+		struct LocalLists {
+			std::array<LocalList, kLocalLists> lists_;
+			~LocalLists();
+		};
+
+		thread_local LocalLists tl_lists;			// スレッドローカル空きリスト
+		thread_local bool tl_lists_destroyed = false;	// 破棄済みフラグ（スレッド終了処理中の返却用）
+
+		LocalLists::~LocalLists() {
+			tl_lists_destroyed = true;
+			for (auto& list : lists_) {
+				list.flush();
+				list.pool_.reset();
+				list.serial_ = 0;
+			}
+		}
+
+		std::atomic<std::uint64_t> g_next_serial{ 1 };	// プールの通し番号
+
+		//---------------------------------------------------------
+		//! @brief  プールに対応するローカルリストを取得
+		//---------------------------------------------------------
+		LocalList& localFor(const ObjectPool* pool) {
+			const auto h = reinterpret_cast<std::uintptr_t>(pool);
+			return tl_lists.lists_[(h >> 6 ^ h >> 12) & (kLocalLists - 1)];
+		}
+
+		//---------------------------------------------------------
+		//! @struct  SlotDeleter
+		//! @brief   ハンドル解放時に reset フックを呼ぶ削除子（破棄はしない）
+		//---------------------------------------------------------
+		struct SlotDeleter {
+			ObjectPool::Slot* slot_;
+			void operator()(void*) const noexcept {
+				slot_->owner_->resetObject(slot_);
+			}
+		};
+
+		//---------------------------------------------------------
+		//! @struct  SlotAllocator
+		//! @brief   ハンドルの制御ブロックをスロット内の領域に配置するアロケータ
+		//! @details 制御ブロックの解放（弱参照も含めて全て解放された時点）でスロットをプールへ戻す
+		//---------------------------------------------------------
+		template<typename T>
+		struct SlotAllocator {
+			using value_type = T;
+			ObjectPool::Slot* slot_;
+
+			explicit SlotAllocator(ObjectPool::Slot* slot) noexcept : slot_(slot) {}
+			template<typename U>
+			SlotAllocator(const SlotAllocator<U>& other) noexcept : slot_(other.slot_) {}
+
+			T* allocate(std::size_t n) {
+				if (n * sizeof(T) <= ObjectPool::kControlBlockSize && alignof(T) <= alignof(std::max_align_t)) {
+					return reinterpret_cast<T*>(slot_->block_);
+				}
+				return static_cast<T*>(::operator new(n * sizeof(T)));	// 想定より大きい処理系向け
+			}
+			void deallocate(T* p, std::size_t) noexcept {
+				if (reinterpret_cast<unsigned char*>(p) != slot_->block_) {
+					::operator delete(p);
+				}
+				// この時点で制御ブロックは破棄済みのため、スロットを再利用してよい
+				std::shared_ptr<ObjectPool> pool = std::move(slot_->owner_);
+				pool->release(slot_);
+			}
+			template<typename U>
+			bool operator==(const SlotAllocator<U>& other) const noexcept { return slot_ == other.slot_; }
+			template<typename U>
+			bool operator!=(const SlotAllocator<U>& other) const noexcept { return slot_ != other.slot_; }
+		};
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	ObjectPool::ObjectPool(ResetFn reset, std::size_t capacity)
+		: reset_(reset), serial_(g_next_serial.fetch_add(1, std::memory_order_relaxed)), capacity_(capacity) {
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  デストラクタ
+	//-------------------------------------------------------------
+	ObjectPool::~ObjectPool() {
+		// 共有リストと各スレッドのローカルリストの分をまとめて破棄（ローカルリストは通し番号の不一致で触れない）
+		for (Slot* slot = slots_; slot; ) {
+			Slot* next = slot->next_;
+			delete slot;
+			slot = next;
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  空きオブジェクトを貸し出す
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ObjectPool::tryAcquire() {
+		// スレッドローカルリストから取得（ロックなし）
+		if (!tl_lists_destroyed) {
+			LocalList& local = localFor(this);
+			if (local.serial_ == serial_ && local.count_ > 0) {
+				return makeHandle(local.items_[--local.count_]);
+			}
+		}
+		// 共有リストから取得（ローカルリストへ半分まで補充）
+		Slot* slot = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (shared_.empty()) {
+				return nullptr;
+			}
+			slot = shared_.back();
+			shared_.pop_back();
+			if (!tl_lists_destroyed) {
+				LocalList& local = localFor(this);
+				if (local.serial_ == serial_) {
+					while (!shared_.empty() && local.count_ < kLocalCapacity / 2) {
+						local.items_[local.count_++] = shared_.back();
+						shared_.pop_back();
+					}
+				}
+			}
+		}
+		return makeHandle(slot);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  新しく構築したオブジェクトをプール管理下に置いて貸し出す
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ObjectPool::adopt(std::shared_ptr<void> object) {
+		Slot* slot = new Slot();
+		slot->object_ = std::move(object);
+		{
+			// 所有するスロットの一覧に加える（構築時のみ）
+			std::lock_guard<std::mutex> lock(mutex_);
+			slot->next_ = slots_;
+			if (slots_) {
+				slots_->prev_ = slot;
+			}
+			slots_ = slot;
+		}
+		return makeHandle(slot);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  保持する空きオブジェクト数の上限を設定
+	//-------------------------------------------------------------
+	void ObjectPool::setCapacity(std::size_t capacity) {
+		capacity_.store(capacity, std::memory_order_relaxed);
+		// 既に上限を超えている分を破棄
+		std::vector<Slot*> excess;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			while (shared_.size() > capacity) {
+				excess.push_back(shared_.back());
+				shared_.pop_back();
+			}
+		}
+		destroy(excess.data(), excess.size());
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  共有リストの空きオブジェクト数を取得
+	//-------------------------------------------------------------
+	std::size_t ObjectPool::sharedIdleCount() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return shared_.size();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  返却されたスロットを受け取る
+	//-------------------------------------------------------------
+	void ObjectPool::release(Slot* slot) {
+		if (slot->discard_) {
+			destroy(&slot, 1);
+			return;
+		}
+		if (!tl_lists_destroyed) {
+			// スレッドローカルリストへ返却（別のプールが使っていれば入れ替える）
+			LocalList& local = localFor(this);
+			if (local.serial_ != serial_) {
+				local.rebind(*this);
+			}
+			else if (local.count_ == kLocalCapacity) {
+				local.flush();	// 溢れた分は共有リストへ
+			}
+			// 旧プールへの返却で破棄されたオブジェクトから再入し、別のプールに使われていなければ置く
+			if (local.serial_ == serial_ && local.count_ < kLocalCapacity) {
+				local.items_[local.count_++] = slot;
+				return;
+			}
+		}
+		returnShared(&slot, 1);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  スロットを共有リストへまとめて戻す
+	//-------------------------------------------------------------
+	void ObjectPool::returnShared(Slot* const* slots, std::size_t count) {
+		std::size_t accepted = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			const std::size_t capacity = capacity_.load(std::memory_order_relaxed);
+			while (accepted < count && shared_.size() < capacity) {
+				shared_.push_back(slots[accepted++]);
+			}
+			for (std::size_t i = accepted; i < count; ++i) {
+				unlink(slots[i]);
+			}
+		}
+		// 上限を超えた分はロック外で破棄（デストラクタからの再入に備える）
+		for (std::size_t i = accepted; i < count; ++i) {
+			delete slots[i];
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  スロットを一覧から外して破棄
+	//-------------------------------------------------------------
+	void ObjectPool::destroy(Slot* const* slots, std::size_t count) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			for (std::size_t i = 0; i < count; ++i) {
+				unlink(slots[i]);
+			}
+		}
+		// ロック外で破棄（デストラクタからの再入に備える）
+		for (std::size_t i = 0; i < count; ++i) {
+			delete slots[i];
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  スロットを一覧から外す
+	//-------------------------------------------------------------
+	void ObjectPool::unlink(Slot* slot) noexcept {
+		if (slot->prev_) {
+			slot->prev_->next_ = slot->next_;
+		}
+		else {
+			slots_ = slot->next_;
+		}
+		if (slot->next_) {
+			slot->next_->prev_ = slot->prev_;
+		}
+		slot->prev_ = slot->next_ = nullptr;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  reset フックを呼ぶ
+	//-------------------------------------------------------------
+	void ObjectPool::resetObject(Slot* slot) noexcept {
+		if (!reset_) {
+			return;
+		}
+		try {
+			reset_(slot->object_.get());
+		}
+		catch (...) {
+			slot->discard_ = true;	// 状態が不明なため再利用しない
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  スロットからハンドルを作成
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ObjectPool::makeHandle(Slot* slot) {
+		slot->owner_ = shared_from_this();
+		slot->discard_ = false;
+		return std::shared_ptr<void>(slot->object_.get(), SlotDeleter{ slot }, SlotAllocator<void>(slot));
+	}
+}// namespace TsukinoDIContainer
@@ -0,0 +1,138 @@
+//-------------------------------------------------------------
+//! @file   PerThreadSlot.cpp
+//! @brief  依存性注入コンテナライブラリの PerThread ライフサイクル用スロット実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/PerThreadSlot.hpp"
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @struct  Entry
+		//! @brief   スレッドローカル配列の 1 要素
+		//---------------------------------------------------------
+		struct Entry {
+			std::uint64_t token_ = 0;			// 所有するスロットのトークン（0 は空き）
+			std::shared_ptr<void> instance_;	// インスタンス
+		};
+
+		thread_local std::vector<Entry> tl_entries;	// スレッドごとのインスタンス配列（スレッド終了時に破棄）
+
+		//---------------------------------------------------------
+		//! @struct  IndexAllocator
+		//! @brief   添字の割り当て状態
+		//---------------------------------------------------------
+		struct IndexAllocator {
+			std::mutex mutex_;						// 割り当て保護用
+			std::vector<std::size_t> free_;			// 返却された添字
+			std::vector<std::uint64_t> owners_;		// 添字ごとの所有するスロットのトークン（0 は空き）
+		};
+
+		//---------------------------------------------------------
+		//! @brief  添字の割り当て状態を取得
+		//! @details 静的なコンテナの破棄より先に破棄されないよう、意図的に解放しない
+		//---------------------------------------------------------
+		IndexAllocator& indexAllocator() {
+			static IndexAllocator* allocator = new IndexAllocator();
+			return *allocator;
+		}
+
+		std::atomic<std::uint64_t> g_next_token{ 1 };	// 次に割り当てるトークン
+		std::atomic<std::uint64_t> g_retire_epoch{ 0 };	// スロットの破棄の世代（破棄のたびに進む）
+		thread_local std::uint64_t tl_seen_epoch = 0;	// 呼び出しスレッドが掃除を済ませた世代
+
+		//---------------------------------------------------------
+		//! @brief  呼び出しスレッドに残った、破棄済みのスロットのインスタンスを解放
+		//---------------------------------------------------------
+		void sweepRetired() {
+			std::vector<std::shared_ptr<void>> released;
+			{
+				IndexAllocator& allocator = indexAllocator();
+				std::lock_guard<std::mutex> lock(allocator.mutex_);
+				tl_seen_epoch = g_retire_epoch.load(std::memory_order_relaxed);	// 世代はロック内で進むため、ここまでの破棄を全て反映
+				for (std::size_t i = 0; i < tl_entries.size(); ++i) {
+					Entry& entry = tl_entries[i];
+					if (entry.token_ != 0 && (i >= allocator.owners_.size() || allocator.owners_[i] != entry.token_)) {
+						released.push_back(std::move(entry.instance_));
+						entry = Entry{};
+					}
+				}
+			}
+			// インスタンスはロック外で破棄（デストラクタからのスロットの生成・破棄に備える）
+		}
+
+		//---------------------------------------------------------
+		//! @brief  破棄されたスロットがあれば掃除（通常は atomic の読み取り 1 回のみ）
+		//---------------------------------------------------------
+		inline void sweepIfRetired() {
+			if (g_retire_epoch.load(std::memory_order_relaxed) != tl_seen_epoch) {
+				sweepRetired();
+			}
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	PerThreadSlot::PerThreadSlot()
+		: token_(g_next_token.fetch_add(1, std::memory_order_relaxed)) {
+		IndexAllocator& allocator = indexAllocator();
+		std::lock_guard<std::mutex> lock(allocator.mutex_);
+		if (!allocator.free_.empty()) {
+			index_ = allocator.free_.back();	// 返却された添字を使い回して配列を密に保つ
+			allocator.free_.pop_back();
+			allocator.owners_[index_] = token_;
+		}
+		else {
+			index_ = allocator.owners_.size();
+			allocator.owners_.push_back(token_);
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  デストラクタ
+	//-------------------------------------------------------------
+	PerThreadSlot::~PerThreadSlot() {
+		// 呼び出しスレッドの分はここで破棄しておく
+		if (index_ < tl_entries.size() && tl_entries[index_].token_ == token_) {
+			Entry released = std::move(tl_entries[index_]);
+			tl_entries[index_] = Entry{};
+		}
+		// 他スレッドの分は、各スレッドの次のアクセスで解放させる
+		IndexAllocator& allocator = indexAllocator();
+		std::lock_guard<std::mutex> lock(allocator.mutex_);
+		allocator.owners_[index_] = 0;
+		allocator.free_.push_back(index_);
+		g_retire_epoch.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドのインスタンスを取得
+	//-------------------------------------------------------------
+	const std::shared_ptr<void>* PerThreadSlot::get() const {
+		sweepIfRetired();
+		if (index_ < tl_entries.size()) {
+			const Entry& entry = tl_entries[index_];
+			if (entry.token_ == token_) {
+				return &entry.instance_;
+			}
+		}
+		return nullptr;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドのインスタンスを設定
+	//-------------------------------------------------------------
+	void PerThreadSlot::set(std::shared_ptr<void> instance) const {
+		sweepIfRetired();
+		if (index_ >= tl_entries.size()) {
+			tl_entries.resize(index_ + 1);
+		}
+		// 以前の所有者のインスタンスは代入後に破棄（デストラクタからの再入に備える）
+		Entry previous = std::exchange(tl_entries[index_], Entry{ token_, std::move(instance) });
+	}
+}// namespace TsukinoDIContainer
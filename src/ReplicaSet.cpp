@@ -0,0 +1,257 @@
+//-------------------------------------------------------------
+//! @file   ReplicaSet.cpp
+//! @brief  依存性注入コンテナライブラリの Replicated ライフサイクル用レプリカ実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/ReplicaSet.hpp"
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @struct  Topology
+		//! @brief   検出した CPU / NUMA ノード構成
+		//---------------------------------------------------------
+		struct Topology {
+			std::size_t cpus_ = 1;					// 論理 CPU 数
+			std::size_t nodes_ = 1;					// NUMA ノード数
+			std::vector<std::size_t> cpuToNode_;	// CPU 番号 → 詰めたノード番号
+		};
+
+#if defined(__linux__)
+		//---------------------------------------------------------
+		//! @brief  "0-3,8,10-11" 形式の一覧を展開
+		//---------------------------------------------------------
+		std::vector<std::size_t> parseList(const std::string& text) {
+			std::vector<std::size_t> values;
+			std::stringstream stream(text);
+			std::string range;
+			while (std::getline(stream, range, ',')) {
+				if (range.empty() || range[0] < '0' || range[0] > '9') continue;
+				const auto dash = range.find('-');
+				const std::size_t first = std::stoul(range.substr(0, dash));
+				const std::size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+				for (std::size_t value = first; value <= last; ++value) {
+					values.push_back(value);
+				}
+			}
+			return values;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  sysfs のファイルを 1 行読む
+		//---------------------------------------------------------
+		bool readLine(const std::string& path, std::string& line) {
+			std::ifstream file(path);
+			return file && std::getline(file, line);
+		}
+#endif
+
+		//---------------------------------------------------------
+		//! @brief  CPU / NUMA ノード構成を検出
+		//---------------------------------------------------------
+		Topology detect() {
+			Topology topology;
+			topology.cpus_ = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+#if defined(__linux__)
+			try {
+				std::string line;
+				if (readLine("/sys/devices/system/cpu/possible", line)) {
+					const auto cpus = parseList(line);
+					if (!cpus.empty()) {
+						topology.cpus_ = *std::max_element(cpus.begin(), cpus.end()) + 1;
+					}
+				}
+				topology.cpuToNode_.assign(topology.cpus_, 0);
+				// ノード番号は飛び番がありうるため、見つかった順に詰める
+				std::size_t dense = 0;
+				if (readLine("/sys/devices/system/node/possible", line)) {
+					for (std::size_t node : parseList(line)) {
+						std::string cpuList;
+						if (!readLine("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", cpuList)) continue;
+						const auto cpus = parseList(cpuList);
+						if (cpus.empty()) continue;	// CPU のないノード（メモリのみ）
+						for (std::size_t cpu : cpus) {
+							if (cpu < topology.cpus_) topology.cpuToNode_[cpu] = dense;
+						}
+						++dense;
+					}
+				}
+				topology.nodes_ = std::max<std::size_t>(1, dense);
+			}
+			catch (...) {
+				topology.nodes_ = 1;
+				topology.cpuToNode_.assign(topology.cpus_, 0);
+			}
+#elif defined(_WIN32)
+			topology.cpus_ = std::max<std::size_t>(1, static_cast<std::size_t>(GetActiveProcessorCount(ALL_PROCESSOR_GROUPS)));
+			ULONG highest = 0;
+			if (GetNumaHighestNodeNumber(&highest)) {
+				topology.nodes_ = static_cast<std::size_t>(highest) + 1;
+			}
+#endif
+			return topology;
+		}
+
+		//---------------------------------------------------------
+		//! @brief  検出済みの構成を取得
+		//---------------------------------------------------------
+		const Topology& topology() {
+			static const Topology instance = detect();
+			return instance;
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  論理 CPU 数を取得
+	//-------------------------------------------------------------
+	std::size_t CpuTopology::cpuCount() {
+		return topology().cpus_;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  NUMA ノード数を取得
+	//-------------------------------------------------------------
+	std::size_t CpuTopology::nodeCount() {
+		return topology().nodes_;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドが実行中の論理 CPU を取得
+	//-------------------------------------------------------------
+	std::size_t CpuTopology::currentCpu() noexcept {
+#if defined(__linux__)
+		const int cpu = sched_getcpu();
+		return cpu < 0 ? 0 : static_cast<std::size_t>(cpu) % topology().cpus_;
+#elif defined(_WIN32)
+		PROCESSOR_NUMBER number;
+		GetCurrentProcessorNumberEx(&number);
+		return (static_cast<std::size_t>(number.Group) * 64 + number.Number) % topology().cpus_;
+#else
+		return 0;
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドが実行中の NUMA ノードを取得
+	//-------------------------------------------------------------
+	std::size_t CpuTopology::currentNode() noexcept {
+		const Topology& current = topology();
+		if (current.nodes_ == 1) {
+			return 0;
+		}
+#if defined(_WIN32)
+		PROCESSOR_NUMBER number;
+		GetCurrentProcessorNumberEx(&number);
+		USHORT node = 0;
+		if (!GetNumaProcessorNodeEx(&number, &node)) {
+			return 0;
+		}
+		return static_cast<std::size_t>(node) % current.nodes_;
+#else
+		const std::size_t cpu = currentCpu();
+		return cpu < current.cpuToNode_.size() ? current.cpuToNode_[cpu] : 0;
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	ReplicaSet::ReplicaSet()
+		: slots_(new Slot[CpuTopology::cpuCount()]), count_(CpuTopology::cpuCount()) {
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドのノード（CPU）のレプリカを取得
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ReplicaSet::get(std::uint64_t generation) const {
+		const Slot& slot = localSlot();
+		std::shared_lock<std::shared_mutex> lock(slot.mutex_);
+		return slot.generation_ == generation ? slot.instance_ : nullptr;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドのノード（CPU）のレプリカを設定
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ReplicaSet::set(std::uint64_t generation, std::shared_ptr<void> instance) {
+		Slot& slot = localSlot();
+		std::shared_ptr<void> previous;	// 古いレプリカはロック外で破棄する
+		{
+			std::unique_lock<std::shared_mutex> lock(slot.mutex_);
+			if (generation != generation_.load(std::memory_order_acquire)) {
+				return instance;	// 構築中に無効化された
+			}
+			if (slot.generation_ == generation && slot.instance_) {
+				return slot.instance_;	// 同じノードの他スレッドが先に設定した
+			}
+			previous = std::move(slot.instance_);
+			slot.instance_ = instance;
+			slot.generation_ = generation;
+		}
+		return instance;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  全てのレプリカを無効化
+	//-------------------------------------------------------------
+	void ReplicaSet::invalidate() {
+		const std::uint64_t current = generation_.fetch_add(1, std::memory_order_acq_rel) + 1;
+		// 古いレプリカを手放す（解決済みのインスタンスは利用者が保持している間は有効）
+		for (std::size_t i = 0; i < count_; ++i) {
+			std::shared_ptr<void> previous;
+			std::unique_lock<std::shared_mutex> lock(slots_[i].mutex_);
+			if (slots_[i].generation_ != current) {
+				previous = std::move(slots_[i].instance_);
+			}
+			lock.unlock();
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  レプリカの単位を設定
+	//-------------------------------------------------------------
+	void ReplicaSet::setGranularity(ReplicaGranularity granularity) {
+		granularity_.store(granularity, std::memory_order_relaxed);
+		invalidate();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  構築済みのレプリカ数を取得
+	//-------------------------------------------------------------
+	std::size_t ReplicaSet::replicaCount() const {
+		const std::uint64_t current = generation();
+		std::size_t count = 0;
+		for (std::size_t i = 0; i < count_; ++i) {
+			std::shared_lock<std::shared_mutex> lock(slots_[i].mutex_);
+			if (slots_[i].generation_ == current && slots_[i].instance_) ++count;
+		}
+		return count;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  呼び出しスレッドのスロットを取得
+	//-------------------------------------------------------------
+	ReplicaSet::Slot& ReplicaSet::localSlot() const noexcept {
+		const std::size_t index = granularity_.load(std::memory_order_relaxed) == ReplicaGranularity::Cpu
+			? CpuTopology::currentCpu()
+			: CpuTopology::currentNode();
+		return slots_[index % count_];
+	}
+}// namespace TsukinoDIContainer
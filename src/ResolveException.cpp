@@ -1,16 +1,121 @@
 //-------------------------------------------------------------
 //! @file   ResolveException.cpp
-//! @brief  ˑReiCu̗O
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリの例外実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include "TsukinoDIContainer/ResolveException.hpp"
-// O : TsukinoDIContainer
+#include <cstdlib>
+#include <utility>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer
 {
+	namespace {
+		const char* const kPrefix = "TsukinoDIContainer Resolve Error: ";	// メッセージの接頭辞
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  型の表示名を取得
+	//-------------------------------------------------------------
+	std::string typeName(const char* rawName) {
+#if defined(__GNUG__)
+		int status = 0;
+		char* demangled = abi::__cxa_demangle(rawName, nullptr, nullptr, &status);
+		if (status == 0 && demangled) {
+			std::string name(demangled);
+			std::free(demangled);
+			return name;
+		}
+		return rawName;
+#else
+		// MSVC の name() は "struct Foo" / "class Foo" 形式のため接頭辞のみ除く
+		std::string name = rawName;
+		for (const char* prefix : { "struct ", "class ", "enum ", "union " }) {
+			const std::string p(prefix);
+			if (name.compare(0, p.size(), p) == 0) {
+				return name.substr(p.size());
+			}
+		}
+		return name;
+#endif
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  型の表示名を取得
 	//-------------------------------------------------------------
-	//! @brief  RXgN^
+	std::string typeName(const TypeId& type) {
+		return type.name();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
 	//-------------------------------------------------------------
 	ResolveException::ResolveException(const std::string& msg)
-		: std::runtime_error("TsukinoDIContainer Resolve Error: " + msg) {
+		: std::runtime_error(kPrefix), detail_(std::make_shared<Detail>()) {
+		detail_->text_ = kPrefix + msg;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	ResolveException::ResolveException(ResolveErrorCode code, std::vector<TypeId> types)
+		: std::runtime_error(kPrefix), detail_(std::make_shared<Detail>()) {
+		detail_->code_ = code;
+		detail_->types_ = std::move(types);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	ResolveException::ResolveException(ResolveErrorCode code, const TypeId& type)
+		: ResolveException(code, std::vector<TypeId>{ type }) {
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  エラーメッセージを取得
+	//-------------------------------------------------------------
+	const char* ResolveException::what() const noexcept {
+		try {
+			std::call_once(detail_->formatted_, [this]() {
+				if (!detail_->text_.empty()) {
+					return; // 文字列指定のメッセージは組み立て済み
+				}
+				std::string names;
+				for (std::size_t i = 0; i < detail_->types_.size(); ++i) {
+					// 循環依存は連鎖、それ以外は列挙として並べる
+					if (i) names += detail_->code_ == ResolveErrorCode::CircularDependency ? " -> " : ", ";
+					names += typeName(detail_->types_[i]);
+				}
+				std::string text = kPrefix;
+				switch (detail_->code_) {
+				case ResolveErrorCode::NotRegistered:      text += "Type not registered: "; break;
+				case ResolveErrorCode::AlreadyRegistered:  text += "Type already registered: "; break;
+				case ResolveErrorCode::CircularDependency: text += "Circular dependency detected: "; break;
+				case ResolveErrorCode::AsyncOnly:          text += "Type has an async factory, use resolveAsync: "; break;
+				default: break;
+				}
+				detail_->text_ = text + names;
+			});
+			return detail_->text_.c_str();
+		}
+		catch (...) {
+			return std::runtime_error::what(); // 組み立てに失敗した場合は接頭辞のみ
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  エラーコードを取得
+	//-------------------------------------------------------------
+	ResolveErrorCode ResolveException::code() const noexcept {
+		return detail_->code_;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  関係する型を取得
+	//-------------------------------------------------------------
+	const std::vector<TypeId>& ResolveException::types() const noexcept {
+		return detail_->types_;
 	}
-}
\ No newline at end of file
+}
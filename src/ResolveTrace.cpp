@@ -0,0 +1,267 @@
+//-------------------------------------------------------------
+//! @file   ResolveTrace.cpp
+//! @brief  依存性注入コンテナライブラリの解決トレース実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/ResolveTrace.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @struct  TraceEvent
+		//! @brief   リングバッファの 1 エントリ
+		//! @details 読み取り側と競合しうるため各フィールドは atomic（書き込み順は head_ で公開）
+		//---------------------------------------------------------
+		struct TraceEvent {
+			std::atomic<const char*> name_{ nullptr };	// 型名（終了イベントは nullptr）
+			std::atomic<std::uint64_t> nanos_{ 0 };		// 時刻（steady_clock）
+			std::atomic<std::uint32_t> info_{ 0 };		// 深さ << 2 | 分類 << 1 | 終了フラグ
+		};
+
+		//---------------------------------------------------------
+		//! @struct  ThreadBuffer
+		//! @brief   スレッド 1 つ分のリングバッファ
+		//! @details 書き込みは所有スレッドのみ。head_ が書き込み済みの件数を公開する。
+		//---------------------------------------------------------
+		struct ThreadBuffer {
+			explicit ThreadBuffer(std::uint32_t tid) : tid_(tid) {}
+			const std::uint32_t tid_;										// 出力するスレッド番号
+			std::array<TraceEvent, ResolveTrace::kCapacity> events_;		// イベント
+			std::atomic<std::uint64_t> head_{ 0 };							// 書き込み済みの件数
+			std::atomic<std::uint64_t> cleared_{ 0 };						// これより前のイベントは破棄済み
+			std::atomic<bool> alive_{ true };								// 所有スレッドが生存しているか
+			std::uint32_t depth_ = 0;										// 現在の入れ子の深さ（所有スレッドのみ参照）
+		};
+
+		//---------------------------------------------------------
+		//! @struct  TraceRegistry
+		//! @brief   全スレッドのバッファ一覧（登録・出力時のみロック）
+		//---------------------------------------------------------
+		struct TraceRegistry {
+			std::mutex mutex_;
+			std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+			std::uint32_t nextTid_ = 1;
+		};
+		TraceRegistry& registry() {
+			static TraceRegistry instance;
+			return instance;
+		}
+
+		//---------------------------------------------------------
+		//! @struct  ThreadHandle
+		//! @brief   スレッドローカルのバッファ参照（スレッド終了時に終了済みにする）
+		//---------------------------------------------------------
+		struct ThreadHandle {
+			std::shared_ptr<ThreadBuffer> buffer_;
+			~ThreadHandle() {
+				if (buffer_) {
+					buffer_->alive_.store(false, std::memory_order_release);
+				}
+			}
+		};
+		thread_local ThreadHandle tl_trace;
+
+		//---------------------------------------------------------
+		//! @brief  呼び出しスレッドのバッファを取得（初回のみ登録）
+		//---------------------------------------------------------
+		ThreadBuffer* threadBuffer() noexcept {
+			if (!tl_trace.buffer_) {
+				try {
+					auto& reg = registry();
+					std::lock_guard<std::mutex> lock(reg.mutex_);
+					tl_trace.buffer_ = std::make_shared<ThreadBuffer>(reg.nextTid_++);
+					reg.buffers_.push_back(tl_trace.buffer_);
+				}
+				catch (...) {
+					return nullptr;	// 確保に失敗した場合は記録しない
+				}
+			}
+			return tl_trace.buffer_.get();
+		}
+
+		//---------------------------------------------------------
+		//! @brief  イベントを 1 件書き込む
+		//---------------------------------------------------------
+		void push(ThreadBuffer& buffer, const char* name, std::uint32_t info) noexcept {
+			const std::uint64_t index = buffer.head_.load(std::memory_order_relaxed);
+			TraceEvent& event = buffer.events_[index % ResolveTrace::kCapacity];
+			event.name_.store(name, std::memory_order_relaxed);
+			event.nanos_.store(static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count()), std::memory_order_relaxed);
+			event.info_.store(info, std::memory_order_relaxed);
+			buffer.head_.store(index + 1, std::memory_order_release);
+		}
+
+		//---------------------------------------------------------
+		//! @struct  Copied
+		//! @brief   出力用に読み出したイベント
+		//---------------------------------------------------------
+		struct Copied {
+			const char* name_;
+			std::uint64_t nanos_;
+			std::uint32_t info_;
+		};
+
+		//---------------------------------------------------------
+		//! @brief  JSON 文字列としてエスケープ
+		//---------------------------------------------------------
+		void appendEscaped(std::string& out, const std::string& text) {
+			for (char c : text) {
+				if (c == '"' || c == '\\') out += '\\';
+				out += c;
+			}
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  解決の開始を記録
+	//-------------------------------------------------------------
+	void ResolveTrace::begin(const char* name, Category category) noexcept {
+		ThreadBuffer* buffer = threadBuffer();
+		if (!buffer) {
+			return;
+		}
+		push(*buffer, name, (buffer->depth_ << 2) | (static_cast<std::uint32_t>(category) << 1));
+		++buffer->depth_;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  直前の begin に対応する解決の終了を記録
+	//-------------------------------------------------------------
+	void ResolveTrace::end() noexcept {
+		ThreadBuffer* buffer = tl_trace.buffer_.get();
+		if (!buffer || buffer->depth_ == 0) {
+			return;
+		}
+		--buffer->depth_;
+		push(*buffer, nullptr, (buffer->depth_ << 2) | 1u);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  記録済みのイベントを Chrome trace 形式で取得
+	//-------------------------------------------------------------
+	std::string ResolveTrace::toChromeJson() {
+		std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+		{
+			auto& reg = registry();
+			std::lock_guard<std::mutex> lock(reg.mutex_);
+			buffers = reg.buffers_;
+		}
+
+		// スレッドごとに読み出す（読み取り中に上書きされた可能性のある範囲は捨てる）
+		std::vector<std::pair<std::uint32_t, std::vector<Copied>>> threads;
+		std::uint64_t origin = UINT64_MAX;
+		for (const auto& buffer : buffers) {
+			const std::uint64_t head = buffer->head_.load(std::memory_order_acquire);
+			std::uint64_t first = std::max(buffer->cleared_.load(std::memory_order_relaxed),
+				head > kCapacity ? head - kCapacity : 0);
+			std::vector<Copied> copied;
+			copied.reserve(static_cast<std::size_t>(head - std::min(first, head)));
+			for (std::uint64_t i = first; i < head; ++i) {
+				const TraceEvent& event = buffer->events_[i % kCapacity];
+				copied.push_back(Copied{
+					event.name_.load(std::memory_order_relaxed),
+					event.nanos_.load(std::memory_order_relaxed),
+					event.info_.load(std::memory_order_relaxed) });
+			}
+			// 読み取り中に進んだ分だけ先頭が上書きされている可能性がある（書き込み中の 1 件を含む）
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const std::uint64_t after = buffer->head_.load(std::memory_order_relaxed);
+			const std::uint64_t safe = after + 1 > kCapacity ? after + 1 - kCapacity : 0;
+			if (safe > first) {
+				copied.erase(copied.begin(), copied.begin() + static_cast<std::ptrdiff_t>(std::min<std::uint64_t>(safe - first, copied.size())));
+			}
+			if (!copied.empty()) {
+				origin = std::min(origin, copied.front().nanos_);
+				threads.emplace_back(buffer->tid_, std::move(copied));
+			}
+		}
+
+		// 型名のエスケープは同じ名前につき 1 回
+		std::unordered_map<const char*, std::string> names;
+		auto nameOf = [&names](const char* raw) -> const std::string& {
+			auto it = names.find(raw);
+			if (it == names.end()) {
+				std::string escaped;
+				appendEscaped(escaped, raw);
+				it = names.emplace(raw, std::move(escaped)).first;
+			}
+			return it->second;
+		};
+
+		std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+		bool firstEvent = true;
+		char number[64];
+		for (const auto& thread : threads) {
+			std::vector<const char*> open;	// 開始済みの型名（終了イベントの名前に使う）
+			for (const auto& event : thread.second) {
+				const bool isEnd = (event.info_ & 1u) != 0;
+				const char* raw = event.name_;
+				if (isEnd) {
+					if (open.empty()) {
+						continue;	// 開始が上書きされた終了イベント
+					}
+					raw = open.back();
+					open.pop_back();
+				}
+				else {
+					open.push_back(raw);
+				}
+				if (!firstEvent) json += ',';
+				firstEvent = false;
+				json += "{\"name\":\"";
+				json += nameOf(raw);
+				json += "\",\"cat\":\"";
+				json += ((event.info_ >> 1) & 1u) ? "scoped" : "resolve";
+				std::snprintf(number, sizeof(number), "\",\"ph\":\"%c\",\"ts\":%.3f", isEnd ? 'E' : 'B', (event.nanos_ - origin) / 1000.0);
+				json += number;
+				std::snprintf(number, sizeof(number), ",\"pid\":1,\"tid\":%u", thread.first);
+				json += number;
+				if (!isEnd) {
+					std::snprintf(number, sizeof(number), ",\"args\":{\"depth\":%u}", event.info_ >> 2);
+					json += number;
+				}
+				json += '}';
+			}
+		}
+		json += "]}";
+		return json;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  記録済みのイベントを Chrome trace 形式でファイルへ出力
+	//-------------------------------------------------------------
+	bool ResolveTrace::writeChromeJson(const std::string& path) {
+		std::ofstream file(path, std::ios::binary);
+		if (!file) {
+			return false;
+		}
+		file << toChromeJson();
+		return static_cast<bool>(file);
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  記録済みのイベントを破棄
+	//-------------------------------------------------------------
+	void ResolveTrace::clear() {
+		auto& reg = registry();
+		std::lock_guard<std::mutex> lock(reg.mutex_);
+		for (const auto& buffer : reg.buffers_) {
+			buffer->cleared_.store(buffer->head_.load(std::memory_order_acquire), std::memory_order_relaxed);
+		}
+		reg.buffers_.erase(std::remove_if(reg.buffers_.begin(), reg.buffers_.end(),
+			[](const std::shared_ptr<ThreadBuffer>& buffer) { return !buffer->alive_.load(std::memory_order_acquire); }),
+			reg.buffers_.end());
+	}
+}// namespace TsukinoDIContainer
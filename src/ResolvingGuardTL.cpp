@@ -1,35 +1,46 @@
 //-------------------------------------------------------------
 //! @file   ResolvingGuardTL.cpp
-//! @brief  ˑReiCȕzˑopK[h
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリの循環依存検出用ガード実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include "TsukinoDIContainer/ResolvingGuardTL.hpp"
 #include "TsukinoDIContainer/ResolveException.hpp"
 #include "TsukinoDIContainer/ResolvingStack.hpp"
-// O : TsukinoDIContainer
+#include <algorithm>
+#include <utility>
+// 名前空間 : TsukinoDIContainer
 namespace TsukinoDIContainer {
 	//---------------------------------------------------------
-	//! @brief  RXgN^
+	//! @brief  コンストラクタ
 	//---------------------------------------------------------
-	ResolvingGuardTL::ResolvingGuardTL(std::type_index t)
+	ResolvingGuardTL::ResolvingGuardTL(TypeId t)
 		: type_(t) {
-		// zˑo
+		// 循環依存検出
 		if (std::find(g_resolving_stack.begin(), g_resolving_stack.end(), type_) != g_resolving_stack.end()) {
-			std::string chain;
-			for (auto& x : g_resolving_stack) {
-				chain += x.name();
-				chain += " -> ";
-			}
-			chain += type_.name();
-			throw ResolveException("Circular dependency detected: " + chain);
+			// 連鎖の型だけを渡し、メッセージは参照時に組み立てる
+			std::vector<TypeId> chain(g_resolving_stack);
+			chain.push_back(type_);
+			throw ResolveException(ResolveErrorCode::CircularDependency, std::move(chain));
 		}
 		g_resolving_stack.push_back(type_);
 		active_ = true;
 	}
 
 	//---------------------------------------------------------
-	//! @brief  fXgN^
-	//! @details X^bN^|bv
+	//! @brief  コンストラクタ（例外を投げない版）
+	//---------------------------------------------------------
+	ResolvingGuardTL::ResolvingGuardTL(TypeId t, std::nothrow_t)
+		: type_(t) {
+		if (std::find(g_resolving_stack.begin(), g_resolving_stack.end(), type_) != g_resolving_stack.end()) {
+			return; // 循環依存（呼び出し側が active_ で判定）
+		}
+		g_resolving_stack.push_back(type_);
+		active_ = true;
+	}
+
+	//---------------------------------------------------------
+	//! @brief  デストラクタ
+	//! @details スタックから型をポップ
 	//---------------------------------------------------------
 	ResolvingGuardTL::~ResolvingGuardTL() {
 		if (active_) {
@@ -1,31 +1,152 @@
 //-------------------------------------------------------------
 //! @file   TsukinoDIContainer.cpp
-//! @brief  ˑReiCũXR[vReLXg
-//! @author R ( Qiita:tsukino_   github:tsukino)
+//! @brief  依存性注入コンテナライブラリのスコープコンテキスト実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
 //-------------------------------------------------------------
 #include "TsukinoDIContainer/Container.hpp"
 #include "TsukinoDIContainer/ScopedContext.hpp"
 #include "TsukinoDIContainer/ResolveException.hpp"
 #include "TsukinoDIContainer/ResolvingGuardTL.hpp"
+#include <utility>
 namespace TsukinoDIContainer {
 	//-------------------------------------------------------------
-	//! @brief  RXgN^
+	//! @brief  コンストラクタ
 	//-------------------------------------------------------------
 	 ScopedContext::ScopedContext(Container& container)
 		: container_(container), active_(true) {
 	}
 
 	//-------------------------------------------------------------
-	//! @brief  fXgN^
+	//! @brief  デストラクタ
 	//-------------------------------------------------------------
 	 ScopedContext::~ScopedContext() {
-		scoped_instances_.clear(); // p̃}bvj
+		scoped_instances_.clear(); // 自分専用のマップを破棄
 	}
 
 	//-------------------------------------------------------------
-	//! @brief  [uRXgN^
+	//! @brief  ムーブコンストラクタ
 	//-------------------------------------------------------------
 	 ScopedContext::ScopedContext(ScopedContext&& other) noexcept
-		: container_(other.container_), active_(std::exchange(other.active_, false)) {
+		: container_(other.container_),
+		scoped_instances_(std::move(other.scoped_instances_)),
+		overrides_(std::move(other.overrides_)),
+		active_(std::exchange(other.active_, false))
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+		, accounting_(std::move(other.accounting_))
+#endif
+	{
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  キーによる型解決（スコープ内の差し替えを優先）
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ScopedContext::resolveByKey(const TypeId& key) {
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+		// 依存の解決中に構築したインスタンスもこのスコープに計上する
+		detail::ScopeAccountingGuard accounting(accounting_);
+#endif
+		// 差し替えがあればそれを返す
+		auto overridden = overrides_.find(key);
+		if (overridden != overrides_.end()) {
+			return resolveOverride(key, overridden->second);
+		}
+
+		// 既にスコープ内に存在する場合はそれを返す
+		auto it = scoped_instances_.find(key);
+		if (it != scoped_instances_.end()) {
+			return it->second;
+		}
+
+		// 登録情報を取得（該当シャードのみロック、未登録ならモジュールを読み込む）
+		const auto reg = container_.findOrLoadRegistration(key);
+		if (!reg) {
+			throw ResolveException(ResolveErrorCode::NotRegistered, key);
+		}
+
+		// 依存を再帰的に解決
+		std::vector<std::shared_ptr<void>> args;
+		args.reserve(reg->deps_.size());
+		for (auto& depKey : reg->deps_) {
+			args.push_back(resolveDependency(depKey));
+		}
+
+		// インスタンス生成（ロック外）
+		auto instance = container_.construct(key, *reg, args);
+
+		// スコープ内に保存
+		scoped_instances_[key] = instance;
+
+		return instance;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  依存の解決（差し替えがあれば Transient / Scoped をスコープ内で構築）
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ScopedContext::resolveDependency(const TypeId& key) {
+		// 差し替えがなければ従来どおりコンテナで解決（追加の検索なし）
+		if (overrides_.empty()) {
+			return container_.resolveByKey(key);
+		}
+		auto overridden = overrides_.find(key);
+		if (overridden != overrides_.end()) {
+			return resolveOverride(key, overridden->second);
+		}
+
+		// 共有される寿命の型はコンテナで解決（差し替えた依存を共有インスタンスに取り込まない）
+		const auto reg = container_.findOrLoadRegistration(key);
+		if (!reg || isShared(reg->cycle_)) {
+			return container_.resolveByKey(key);
+		}
+		if (reg->cycle_ == Lifecycle::Scoped) {
+			auto it = scoped_instances_.find(key);
+			if (it != scoped_instances_.end()) {
+				return it->second;
+			}
+		}
+
+		// 差し替えた依存を反映するためスコープ内で構築
+		ResolvingGuardTL guard(key);
+		std::vector<std::shared_ptr<void>> args;
+		args.reserve(reg->deps_.size());
+		for (auto& depKey : reg->deps_) {
+			args.push_back(resolveDependency(depKey));
+		}
+		auto instance = container_.construct(key, *reg, args);
+		if (reg->cycle_ == Lifecycle::Scoped) {
+			scoped_instances_[key] = instance;
+		}
+		return instance;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  差し替えのインスタンスを取得（overrideType は初回のみ構築）
+	//-------------------------------------------------------------
+	std::shared_ptr<void> ScopedContext::resolveOverride(const TypeId& key, Override& override) {
+		if (!override.instance_ && override.ctor_) {
+			ResolvingGuardTL guard(key);
+			std::vector<std::shared_ptr<void>> args;
+			args.reserve(override.deps_.size());
+			for (auto& depKey : override.deps_) {
+				args.push_back(resolveDependency(depKey));
+			}
+			override.instance_ = override.ctor_(args);
+		}
+		return override.instance_;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  このスコープで構築したインスタンスの型ごとの計上値を取得
+	//-------------------------------------------------------------
+	InstanceAccounting ScopedContext::instanceAccounting() const {
+#if TSUKINO_DI_INSTANCE_ACCOUNTING
+		std::vector<TypeAccounting> types;
+		types.reserve(accounting_.types_.size());
+		for (const auto& [type, counters] : accounting_.types_) {
+			types.push_back(counters->snapshot(type));
+		}
+		return detail::makeInstanceAccounting(std::move(types));
+#else
+		return InstanceAccounting{};
+#endif
 	}
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+//-------------------------------------------------------------
+//! @file   ThreadPoolExecutor.cpp
+//! @brief  依存性注入コンテナライブラリの簡易スレッドプール実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/ThreadPoolExecutor.hpp"
+#include <utility>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @brief  コンストラクタ
+	//-------------------------------------------------------------
+	ThreadPoolExecutor::ThreadPoolExecutor(std::size_t threadCount) {
+		if (threadCount == 0) {
+			threadCount = std::thread::hardware_concurrency();
+		}
+		if (threadCount == 0) {
+			threadCount = 1; // 取得できない環境向けのフォールバック
+		}
+		workers_.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i) {
+			workers_.emplace_back([this]() { workerLoop(); });
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  デストラクタ
+	//-------------------------------------------------------------
+	ThreadPoolExecutor::~ThreadPoolExecutor() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stopping_ = true;
+		}
+		cv_.notify_all();
+		for (auto& t : workers_) {
+			t.join();	// 残りのジョブを実行し終えてから終了
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  ジョブ投入
+	//-------------------------------------------------------------
+	void ThreadPoolExecutor::post(std::function<void()> job) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			jobs_.push_back(std::move(job));
+		}
+		cv_.notify_one();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  ワーカースレッド数を取得
+	//-------------------------------------------------------------
+	std::size_t ThreadPoolExecutor::threadCount() const {
+		return workers_.size();
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  ワーカースレッドの処理ループ
+	//-------------------------------------------------------------
+	void ThreadPoolExecutor::workerLoop() {
+		for (;;) {
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				cv_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+				if (jobs_.empty()) {
+					return; // 終了要求かつキューが空
+				}
+				job = std::move(jobs_.front());
+				jobs_.pop_front();
+			}
+			job();	// ロック外で実行
+		}
+	}
+}// namespace TsukinoDIContainer
@@ -0,0 +1,65 @@
+//-------------------------------------------------------------
+//! @file   TypeId.cpp
+//! @brief  依存性注入コンテナライブラリの型識別子実装（std::type_index との相互変換）
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/TypeId.hpp"
+#if TSUKINO_DI_TYPE_INDEX
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	namespace {
+		//---------------------------------------------------------
+		//! @struct  TypeIndexRegistry
+		//! @brief   type_index → TypeId の対応表（登録時のみ追加）
+		//---------------------------------------------------------
+		struct TypeIndexRegistry {
+			std::shared_mutex mutex_;
+			std::unordered_map<std::type_index, TypeId> ids_;
+		};
+
+		//---------------------------------------------------------
+		//! @brief  対応表を取得
+		//---------------------------------------------------------
+		TypeIndexRegistry& registry() {
+			static TypeIndexRegistry instance;
+			return instance;
+		}
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  std::type_index から型識別子を検索
+	//-------------------------------------------------------------
+	bool TypeId::fromTypeIndex(const std::type_index& type, TypeId& id) {
+		TypeIndexRegistry& table = registry();
+		std::shared_lock<std::shared_mutex> lock(table.mutex_);
+		auto it = table.ids_.find(type);
+		if (it == table.ids_.end()) {
+			return false;
+		}
+		id = it->second;
+		return true;
+	}
+
+	namespace detail {
+		//---------------------------------------------------------
+		//! @brief  TypeId::fromTypeIndex で検索できるよう型識別子を公開
+		//---------------------------------------------------------
+		void publishTypeId(const TypeId& id) {
+			TypeIndexRegistry& table = registry();
+			const std::type_index type = id.typeIndex();
+			{
+				// 公開済みなら共有ロックのみ（同じ型の再登録や子コンテナでの登録）
+				std::shared_lock<std::shared_mutex> lock(table.mutex_);
+				if (table.ids_.find(type) != table.ids_.end()) {
+					return;
+				}
+			}
+			std::unique_lock<std::shared_mutex> lock(table.mutex_);
+			table.ids_.emplace(type, id);
+		}
+	}
+}// namespace TsukinoDIContainer
+#endif
@@ -0,0 +1,30 @@
+//-------------------------------------------------------------
+//! @file   ValidationReport.cpp
+//! @brief  依存性注入コンテナライブラリの検証結果実装
+//! @author 山﨑愛 ( Qiita:tsukino_   github:tsukino)
+//-------------------------------------------------------------
+#include "TsukinoDIContainer/ValidationReport.hpp"
+#include "TsukinoDIContainer/ResolveException.hpp"
+// 名前空間 : TsukinoDIContainer
+namespace TsukinoDIContainer {
+	//-------------------------------------------------------------
+	//! @brief  全ての問題を 1 行ずつ並べた文字列を取得
+	//-------------------------------------------------------------
+	std::string ValidationReport::toString() const {
+		std::string text;
+		for (const auto& issue : issues_) {
+			text += issue.message_;
+			text += '\n';
+		}
+		return text;
+	}
+
+	//-------------------------------------------------------------
+	//! @brief  問題があれば例外を投げる
+	//-------------------------------------------------------------
+	void ValidationReport::throwIfFailed() const {
+		if (!ok()) {
+			throw ResolveException("Validation failed (" + std::to_string(issues_.size()) + " issue(s)):\n" + toString());
+		}
+	}
+}// namespace TsukinoDIContainer